@@ -0,0 +1,1767 @@
+/*
+ * bench.c — headless benchmarks for the game core (oyun çekirdeği kıyaslamaları)
+ *
+ *   gcc -O2 bench.c board.c bitplane.c solver.c generate.c prob.c sim.c replay.c snapshot.c journal.c trace.c flood.c openings.c pool.c grade.c -o bench -pthread -lm
+ *   ./bench reveal
+ *   ./bench huge
+ *   ./bench neighbors
+ *   ./bench place
+ *   ./bench noguess [threads]
+ *   ./bench solver
+ *   ./bench prob
+ *   ./bench sim [strategy] [games] [threads]
+ *   ./bench suite [samples] > results.json
+ *   ./bench replay [file.mrp …]
+ *   ./bench snapshot
+ *   ./bench undo
+ *   ./bench presets
+ *   ./bench trace [out.json]
+ *   ./bench flood [threads]
+ *   ./bench openings
+ *   ./bench pool
+ *   ./bench grade [rows cols mines [boards] [threads] [seed]] > hist.csv
+ *
+ * reveal: iterative scanline reveal vs. the original recursive reveal_cell on
+ * fully open (mine-free) boards, the worst case for both — one click opens
+ * every cell. The recursive version runs on a thread with a 2 GiB stack so
+ * the larger sizes can finish at all; its peak depth is reported next to the
+ * 1 MiB default Windows main-thread stack it would have to fit in. The
+ * "+changes" column is the same reveal recording its change-set.
+ *
+ * huge: deal, count and open 10^6 … 10^8-cell boards at low density and
+ * report how many chunks ended up allocated, the packed cell footprint and
+ * the size of the optional one-bit-per-cell mine plane.
+ *
+ * neighbors: the original branchy 3×3 gather loop vs. the bit-sliced
+ * kernel (scalar / SSE2 / AVX2) and the full board_compute_neighbors,
+ * at 16 % density; plus one bit-parallel dilation pass per kernel.
+ *
+ * place: the original rand() % ROWS rejection loop vs. the seeded
+ * placement across densities, and a check that a seed reproduces its board.
+ *
+ * noguess: deal no-guess boards for the three classic presets from a
+ * center first click; reports latency per board and candidates tried per
+ * second, and checks that one thread picks the same board as many.
+ *
+ * solver: a fixed corpus of expert boards (seeds 1 … 1000, first click in
+ * the center). Positions per second for solver_deduce on the position
+ * after the first click, and full games per second for solver_solve_from,
+ * with single-cell rules only and with the subset/superset rules.
+ *
+ * prob: the exact probability engine, first checked against brute-force
+ * enumeration on small boards, then timed on 30×30 positions where
+ * deduction is stuck (the positions a player would ask it about).
+ *
+ * sim: complete games on the three classic presets plus a 30×30 board at
+ * 20 %, with the given strategy (random, solver or prob; default solver),
+ * spread over every core. Reports win rate, mean 3BV and games per second
+ * per configuration, and checks that one thread gives the same totals.
+ *
+ * suite: the core routines behind a game — placement, neighbor counts,
+ * reveal of an all-zero board (the worst case), the reset at the start of
+ * init_game and the check_win test — over a matrix of board sizes and
+ * densities, written to stdout as JSON with min / median / p99 per case
+ * in nanoseconds, for tracking regressions between builds.
+ *
+ * replay: with files, re-execute each recording and check its outcome.
+ * Without, record games played by the solver strategy (with flags placed
+ * and lifted along the way), encode and decode them, verify every one,
+ * and check that seeking to random moves matches replaying from the
+ * start; reports bytes per event, replay speed and seek latency.
+ *
+ * snapshot: save a game in progress (several openings and flags) and
+ * restore it into a fresh board, 30×30 … 10^8 cells; every cell must
+ * survive, and restore time is set against recounting the neighbors.
+ *
+ * undo: clear boards of 30×30 … 4096×4096 by clicking every safe cell in
+ * a scattered order and flagging half the mines, journaling each action,
+ * then undo everything and redo it; the board must come back empty and
+ * then byte-identical. Reports journal bytes against board bytes and the
+ * cost per undone cell.
+ *
+ * presets: neighbor counting and whole games of reveals on the standard
+ * sizes, with the kernels compiled for that size against the generic code
+ * (b.kern cleared) on the same 2000 seeds; both must leave identical boards.
+ *
+ * trace: cost of one trace event on one thread and on every core at once,
+ * then checks that full rings dump exactly their capacity and that rings
+ * given back by finished threads are reused. With a file name, first
+ * writes a trace of no-guess expert deals and solver-played games there;
+ * build with -DMINES_TRACE to include the probes inside generate.c.
+ *
+ * flood: board_reveal_parallel against board_reveal. First random clicks
+ * on 300×500 boards at 2–15 % density with scattered flags, on 4 workers
+ * whatever the core count: return values, every cell byte and the sorted
+ * change-sets must match. Then one click opening a 0.1 %-density board of
+ * 2048², 4096² and 10^8 cells, timed serially and on 2, 4 … threads
+ * (default: one per CPU), with the speedup over the serial reveal.
+ *
+ * openings: the zero-region index on expert up to 4096² boards. Random
+ * clicks with flags set and lifted along the way must match board_reveal
+ * cell for cell; then the index build is timed against counting the
+ * neighbors, and opening every region of a fresh board through the index
+ * against flooding each, with the number and sizes of the openings.
+ *
+ * pool: what New Game costs with and without the board pool, from expert
+ * to 10^8 cells: a synchronous deal (with the opening index where the game
+ * builds one) against taking a ready board. Every board taken must equal
+ * a fresh deal of its seed, index included; a change of size must drop
+ * the ready boards of the old one.
+ *
+ * grade: board metrics (grade.h). 3BV, openings, isolated cells and
+ * islands are first checked against flooding cell by cell on 2000 boards
+ * of mixed sizes and densities, ZiNi against a hand-worked 3×3 board and
+ * the bounds openings ≤ ZiNi ≤ 3BV. Then 200000 boards per preset are
+ * graded on every core, with all metrics and with 3BV alone, and one
+ * thread must give the same histograms as many. With a size, grades that
+ * many seeded boards instead and writes the histograms as CSV to stdout.
+ */
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "board.h"
+#include "flood.h"
+#include "openings.h"
+#include "pool.h"
+#include "generate.h"
+#include "grade.h"
+#include "prob.h"
+#include "replay.h"
+#include "snapshot.h"
+#include "journal.h"
+#include "rng.h"
+#include "sim.h"
+#include "solver.h"
+#include "thread.h"
+#include "trace.h"
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/* Monotonic: wall-clock seconds since 1970 leave a double only ~0.2 µs of
+   resolution (duvar saati double'da yalnızca ~0,2 µs çözünürlük bırakır) */
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* ── Reference: the original recursive reveal (özgün özyinelemeli açma) ─ */
+static size_t rec_depth, rec_max_depth;
+
+static void reveal_recursive(Board *b, int r, int c) {
+    if (r < 0 || r >= b->rows || c < 0 || c >= b->cols) return;
+    if (board_revealed(b, r, c) || board_flagged(b, r, c)) return;
+    if (++rec_depth > rec_max_depth) rec_max_depth = rec_depth;
+
+    board_touch(b, r, c)->cell[chunk_index(r, c)] |= CELL_REVEALED;
+    b->revealed_count++;
+    if (board_mine(b, r, c)) { b->exploded = true; rec_depth--; return; }
+
+    if (board_neigh(b, r, c) == 0)
+        for (int dr = -1; dr <= 1; dr++)
+            for (int dc = -1; dc <= 1; dc++) {
+                if (!dr && !dc) continue;
+                int rr = r+dr, cc = c+dc;
+                if (rr >= 0 && rr < b->rows && cc >= 0 && cc < b->cols
+                    && !board_revealed(b, rr, cc) && !board_mine(b, rr, cc) && !board_flagged(b, rr, cc))
+                    reveal_recursive(b, rr, cc);
+            }
+    rec_depth--;
+}
+
+typedef struct { Board *b; double secs; } RecJob;
+
+static void *rec_thread(void *arg) {
+    RecJob *job = arg;
+    rec_depth = rec_max_depth = 0;
+    double t0 = now_sec();
+    reveal_recursive(job->b, job->b->rows / 2, job->b->cols / 2);
+    job->secs = now_sec() - t0;
+    return NULL;
+}
+
+static bool run_recursive(Board *b, double *secs) {
+    pthread_attr_t attr;
+    pthread_t th;
+    RecJob job = {b, 0};
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, (size_t)2 << 30);
+    bool ok = pthread_create(&th, &attr, rec_thread, &job) == 0;
+    pthread_attr_destroy(&attr);
+    if (!ok) return false;
+    pthread_join(th, NULL);
+    *secs = job.secs;
+    return true;
+}
+
+/* Fresh mine-free board; chunks are allocated by the reveal itself (boş tahta) */
+static void clear_revealed(Board *b) {
+    board_setup(b, b->rows, b->cols, 0);
+}
+
+static int bench_reveal(void) {
+    static const int sizes[] = {30, 256, 1024, 2048, 4096};
+    printf("%-11s %12s %12s %12s %9s %10s %12s\n", "board", "iterative", "+changes", "recursive", "speedup",
+           "depth", "~stack@64B");
+    for (size_t k = 0; k < sizeof sizes / sizeof *sizes; k++) {
+        int n = sizes[k];
+        Board b = {0};
+        if (!board_setup(&b, n, n, 0)) { fprintf(stderr, "out of memory at %dx%d\n", n, n); return 1; }
+        board_compute_neighbors(&b);
+
+        /* Small boards finish too fast for one sample (küçük tahtalar için tekrar) */
+        int reps = n <= 256 ? 200 : n <= 1024 ? 10 : 3;
+        double it = 1e30, rc = 1e30;
+        for (int rep = 0; rep < reps; rep++) {
+            clear_revealed(&b);
+            double t0 = now_sec();
+            board_reveal(&b, n / 2, n / 2, NULL);
+            double t = now_sec() - t0;
+            if (t < it) it = t;
+            if (b.revealed_count != n * n) { fprintf(stderr, "iterative reveal incomplete\n"); return 1; }
+        }
+        /* Same reveal recording a change-set (değişiklik kümesiyle aynı açma) */
+        ChangeSet cs = {0};
+        double cst = 1e30;
+        for (int rep = 0; rep < reps; rep++) {
+            clear_revealed(&b);
+            changes_clear(&cs);
+            double t0 = now_sec();
+            board_reveal(&b, n / 2, n / 2, &cs);
+            double t = now_sec() - t0;
+            if (t < cst) cst = t;
+            if (cs.oom || cs.n != (size_t)n * n || cs.r0 != 0 || cs.c1 != n - 1) {
+                fprintf(stderr, "change-set does not match the reveal\n");
+                return 1;
+            }
+        }
+        changes_free(&cs);
+        for (int rep = 0; rep < reps; rep++) {
+            clear_revealed(&b);
+            double t;
+            if (!run_recursive(&b, &t)) { rc = 0; break; }
+            if (t < rc) rc = t;
+        }
+
+        char name[24];
+        snprintf(name, sizeof name, "%dx%d", n, n);
+        if (rc > 0)
+            printf("%-11s %10.3fms %10.3fms %10.3fms %8.1fx %10zu %9.1fMiB\n", name, it * 1e3, cst * 1e3,
+                   rc * 1e3, rc / it, rec_max_depth, rec_max_depth * 64 / 1048576.0);
+        else
+            printf("%-11s %10.3fms %10.3fms %12s\n", name, it * 1e3, cst * 1e3, "n/a");
+        board_free(&b);
+    }
+    return 0;
+}
+
+static int bench_huge(void) {
+    static const int sizes[] = {1000, 3162, 10000};
+    printf("%-13s %8s %10s %10s %10s %9s %12s %9s %10s\n", "board", "mines",
+           "place", "neighbors", "reveal", "opened", "chunks", "cells", "mine plane");
+    for (size_t k = 0; k < sizeof sizes / sizeof *sizes; k++) {
+        int n = sizes[k];
+        int mines = (int)((long long)n * n / 1000);   /* 0.1 % density */
+        Board b = {0};
+        if (!board_setup(&b, n, n, mines)) { fprintf(stderr, "out of memory at %dx%d\n", n, n); return 1; }
+
+        double t0 = now_sec();
+        b.seed = 1;
+        board_place_mines(&b);
+        double t1 = now_sec();
+        board_compute_neighbors(&b);
+        double t2 = now_sec();
+        int r = n / 2, c = n / 2;
+        while (board_mine(&b, r, c) || board_neigh(&b, r, c)) c = (c + 1) % n;
+        int opened = board_reveal(&b, r, c, NULL);
+        double t3 = now_sec();
+
+        /* Word-wide view of the mines: one bit per cell (mayınların bit düzlemi) */
+        BitPlane mp = {0};
+        if (!plane_setup(&mp, n, n)) { fprintf(stderr, "out of memory at %dx%d\n", n, n); return 1; }
+        board_extract_plane(&b, CELL_MINE, CELL_MINE, &mp);
+        if (plane_count(&mp) != (size_t)mines) { fprintf(stderr, "mine plane mismatch\n"); return 1; }
+
+        char name[24], chunks[24];
+        snprintf(name, sizeof name, "%dx%d", n, n);
+        snprintf(chunks, sizeof chunks, "%zu/%zu", b.chunks_live, (size_t)b.chunk_rows * b.chunk_cols);
+        printf("%-13s %8d %8.1fms %8.1fms %8.1fms %9d %12s %6.1fMiB %7.1fMiB\n", name, mines,
+               (t1 - t0) * 1e3, (t2 - t1) * 1e3, (t3 - t2) * 1e3, opened, chunks,
+               b.chunks_live * sizeof(Chunk) / 1048576.0,
+               mp.rows * mp.stride * sizeof *mp.bits / 1048576.0);
+        plane_free(&mp);
+        board_free(&b);
+    }
+    return 0;
+}
+
+/* ── Neighbor counting (Komşu sayımı) ────────────────────────────────── */
+/* The original per-cell loop over flat arrays (özgün hücre başına döngü) */
+static void neighbors_reference(const bool *mine, int *neigh, int R, int C) {
+    for (int r = 0; r < R; r++)
+        for (int c = 0; c < C; c++) {
+            if (mine[(size_t)r * C + c]) { neigh[(size_t)r * C + c] = -1; continue; }
+            int cnt = 0;
+            for (int dr = -1; dr <= 1; dr++)
+                for (int dc = -1; dc <= 1; dc++) {
+                    if (!dr && !dc) continue;
+                    int rr = r+dr, cc = c+dc;
+                    if (rr >= 0 && rr < R && cc >= 0 && cc < C && mine[(size_t)rr * C + cc]) cnt++;
+                }
+            neigh[(size_t)r * C + c] = cnt;
+        }
+}
+
+static double time_kernel(const BitPlane *mp, uint64_t **out, PlaneKernel k, int reps) {
+    double best = 1e30;
+    for (int rep = 0; rep < reps; rep++) {
+        double t0 = now_sec();
+        for (int r = 0; r < mp->rows; r++) plane_count_row(mp, r, out, k);
+        double t = now_sec() - t0;
+        if (t < best) best = t;
+    }
+    return best;
+}
+
+static int bench_neighbors(void) {
+    static const int sizes[] = {30, 1024, 16384};
+    static const PlaneKernel kernels[] = {PLANE_SCALAR, PLANE_SSE2, PLANE_AVX2};
+    printf("%-12s %11s", "board", "reference");
+    for (size_t k = 0; k < 3; k++) printf(" %11s", plane_kernel_name(kernels[k]));
+    printf(" %11s %9s %10s\n", "board_cnt", "best x", "dilate");
+
+    for (size_t si = 0; si < sizeof sizes / sizeof *sizes; si++) {
+        int n = sizes[si];
+        size_t cells = (size_t)n * n;
+        int reps = n <= 30 ? 20000 : n <= 1024 ? 20 : 2;
+        Board b = {0};
+        if (!board_setup(&b, n, n, (int)(cells * 16 / 100))) { fprintf(stderr, "out of memory\n"); return 1; }
+        b.seed = 5;
+        board_place_mines(&b);
+
+        bool *mine  = malloc(cells * sizeof *mine);
+        int  *neigh = malloc(cells * sizeof *neigh);
+        BitPlane mp = {0}, dp = {0};
+        if (!mine || !neigh || !plane_setup(&mp, n, n) || !plane_setup(&dp, n, n)) {
+            fprintf(stderr, "out of memory\n"); return 1;
+        }
+        for (int r = 0; r < n; r++)
+            for (int c = 0; c < n; c++) mine[(size_t)r * n + c] = board_mine(&b, r, c);
+        board_extract_plane(&b, CELL_MINE, CELL_MINE, &mp);
+
+        double ref = 1e30;
+        for (int rep = 0; rep < reps; rep++) {
+            double t0 = now_sec();
+            neighbors_reference(mine, neigh, n, n);
+            double t = now_sec() - t0;
+            if (t < ref) ref = t;
+        }
+
+        uint64_t *sl = malloc(4 * mp.stride * sizeof *sl);
+        uint64_t *out[4] = {sl, sl + mp.stride, sl + 2 * mp.stride, sl + 3 * mp.stride};
+        double kt[3], best = 1e30;
+        for (size_t k = 0; k < 3; k++) {
+            kt[k] = time_kernel(&mp, out, kernels[k], reps);
+            if (kt[k] < best) best = kt[k];
+        }
+
+        /* Kernel output must match the reference, row by row (referansla karşılaştır) */
+        for (int r = 0; r < n; r++) {
+            plane_count_row(&mp, r, out, PLANE_AUTO);
+            for (int c = 0; c < n; c++) {
+                size_t w = (size_t)c >> 6; int bit = c & 63;
+                int cnt = (int)(((out[0][w] >> bit) & 1) | ((out[1][w] >> bit) & 1) << 1
+                              | ((out[2][w] >> bit) & 1) << 2 | ((out[3][w] >> bit) & 1) << 3);
+                int want = neigh[(size_t)r * n + c];
+                if (want >= 0 && cnt != want) { fprintf(stderr, "kernel mismatch at %d,%d\n", r, c); return 1; }
+            }
+        }
+
+        double bt = 1e30;
+        for (int rep = 0; rep < (reps > 200 ? 200 : reps); rep++) {
+            double t0 = now_sec();
+            board_compute_neighbors(&b);
+            double t = now_sec() - t0;
+            if (t < bt) bt = t;
+        }
+        for (int r = 0; r < n; r++)
+            for (int c = 0; c < n; c++)
+                if (board_neigh(&b, r, c) != neigh[(size_t)r * n + c]) {
+                    fprintf(stderr, "board mismatch at %d,%d\n", r, c); return 1;
+                }
+
+        double dt = 1e30;
+        for (int rep = 0; rep < reps; rep++) {
+            double t0 = now_sec();
+            plane_dilate(&mp, &dp, PLANE_AUTO);
+            double t = now_sec() - t0;
+            if (t < dt) dt = t;
+        }
+
+        char name[24];
+        snprintf(name, sizeof name, "%dx%d", n, n);
+        printf("%-12s %9.3fms", name, ref * 1e3);
+        for (size_t k = 0; k < 3; k++) printf(" %9.3fms", kt[k] * 1e3);
+        printf(" %9.3fms %8.1fx %8.3fms\n", bt * 1e3, ref / best, dt * 1e3);
+
+        free(sl); free(mine); free(neigh);
+        plane_free(&mp); plane_free(&dp);
+        board_free(&b);
+    }
+    printf("(kernel auto = %s)\n", plane_kernel_name(plane_kernel_resolve(PLANE_AUTO)));
+    return 0;
+}
+
+/* ── Mine placement (Mayın yerleştirme) ──────────────────────────────── */
+/* The original placement, on a flat array (özgün yerleştirme) */
+static void place_reference(bool *mine, int R, int C, int mines) {
+    memset(mine, 0, (size_t)R * C * sizeof *mine);
+    int placed = 0;
+    while (placed < mines) {
+        int r = rand() % R, c = rand() % C;
+        if (!mine[(size_t)r * C + c]) { mine[(size_t)r * C + c] = true; placed++; }
+    }
+}
+
+static int bench_place(void) {
+    static const int density[] = {1, 10, 20, 50, 80, 95, 99, 100};
+    const int n = 1000;
+    bool *mine = malloc((size_t)n * n * sizeof *mine);
+    if (!mine) { fprintf(stderr, "out of memory\n"); return 1; }
+    printf("%dx%d\n%-8s %12s %12s %12s\n", n, n, "density", "rand()", "seeded", "ns/mine");
+    for (size_t k = 0; k < sizeof density / sizeof *density; k++) {
+        int mines = (int)((long long)n * n * density[k] / 100);
+        if (mines == n * n) mines--;            /* keep one safe cell, as the UI does */
+
+        srand(1);
+        double t0 = now_sec();
+        place_reference(mine, n, n, mines);
+        double ref = now_sec() - t0;
+
+        Board b = {0};
+        if (!board_setup(&b, n, n, mines)) { fprintf(stderr, "out of memory\n"); return 1; }
+        b.seed = 0x5EED0000u + (uint64_t)k;
+        t0 = now_sec();
+        board_place_mines(&b);
+        double t = now_sec() - t0;
+
+        /* Same seed, same board (aynı tohum, aynı tahta) */
+        Board again = {0};
+        board_setup(&again, n, n, mines);
+        again.seed = b.seed;
+        board_place_mines(&again);
+        int placed = 0;
+        for (int r = 0; r < n; r++)
+            for (int c = 0; c < n; c++) {
+                placed += board_mine(&b, r, c);
+                if (board_mine(&b, r, c) != board_mine(&again, r, c)) {
+                    fprintf(stderr, "seed did not reproduce the board\n"); return 1;
+                }
+            }
+        if (placed != mines) { fprintf(stderr, "placed %d of %d mines\n", placed, mines); return 1; }
+
+        char name[16];
+        snprintf(name, sizeof name, "%d%%", density[k]);
+        printf("%-8s %10.2fms %10.2fms %12.1f\n", name, ref * 1e3, t * 1e3, t * 1e9 / (mines ? mines : 1));
+        board_free(&b);
+        board_free(&again);
+    }
+    free(mine);
+    return 0;
+}
+
+/* ── No-guess generation (Tahminsiz üretim) ──────────────────────────── */
+static int bench_noguess(int threads) {
+    static const struct { const char *name; int rows, cols, mines; } preset[] = {
+        {"beginner",     9,  9, 10},
+        {"intermediate", 16, 16, 40},
+        {"expert",       16, 30, 99},
+    };
+    const int deals = 50;
+    if (threads <= 0) threads = thread_cpu_count();
+    printf("%d threads, %d boards per preset, first click in the center\n", threads, deals);
+    printf("%-13s %10s %10s %12s %14s\n", "preset", "mean", "max", "cand/board", "cand/s");
+    Solver v = {0};
+    for (size_t p = 0; p < sizeof preset / sizeof *preset; p++) {
+        int R = preset[p].rows, C = preset[p].cols, r = R / 2, c = C / 2;
+        double total = 0, worst = 0;
+        uint64_t cand = 0;
+        for (int d = 0; d < deals; d++) {
+            Board b = {0};
+            board_setup(&b, R, C, preset[p].mines);
+            b.seed = 1000 + (uint64_t)d;
+            GenStats st;
+            double t0 = now_sec();
+            bool ok = generate_no_guess(&b, r, c, threads, 1u << 20, &st);
+            double t = now_sec() - t0;
+            total += t; cand += st.candidates;
+            if (t > worst) worst = t;
+            if (!ok || !solver_solve_from(&v, &b, r, c)) {
+                fprintf(stderr, "%s: seed %d did not give a no-guess board\n", preset[p].name, d);
+                return 1;
+            }
+            /* Same board with a single worker (tek işçiyle aynı tahta) */
+            Board one = {0};
+            board_setup(&one, R, C, preset[p].mines);
+            one.seed = 1000 + (uint64_t)d;
+            generate_no_guess(&one, r, c, 1, 1u << 20, NULL);
+            if (one.seed != b.seed) { fprintf(stderr, "thread count changed the board\n"); return 1; }
+            board_free(&one);
+            board_free(&b);
+        }
+        printf("%-13s %8.2fms %8.2fms %12.1f %14.0f\n", preset[p].name, total / deals * 1e3,
+               worst * 1e3, (double)cand / deals, (double)cand / total);
+    }
+    solver_free(&v);
+    return 0;
+}
+
+/* ── Deduction solver (Çıkarım çözücüsü) ─────────────────────────────── */
+static int bench_solver(void) {
+    enum { CORPUS = 1000, R = 16, C = 30, MINES = 99 };
+    Board *corpus = calloc(CORPUS, sizeof *corpus);
+    if (!corpus) { fprintf(stderr, "out of memory\n"); return 1; }
+    for (int k = 0; k < CORPUS; k++) {
+        Board *b = &corpus[k];
+        board_setup(b, R, C, MINES);
+        b->seed = (uint64_t)k + 1;
+        board_place_mines_around(b, R / 2, C / 2);
+        board_compute_neighbors(b);
+        board_reveal(b, R / 2, C / 2, NULL);
+    }
+    printf("expert %dx%d/%d, %d seeds, first click in the center\n", C, R, MINES, CORPUS);
+    printf("%-8s %16s %12s %14s %10s\n", "rules", "deduce pos/s", "decided", "solve games/s", "solved");
+    for (int single = 1; single >= 0; single--) {
+        Solver v = {.single_only = single};
+        int reps = 20;
+        long decided = 0;
+        double t0 = now_sec();
+        for (int rep = 0; rep < reps; rep++)
+            for (int k = 0; k < CORPUS; k++) decided += solver_deduce(&v, &corpus[k], false);
+        double td = now_sec() - t0;
+
+        int solved = 0;
+        t0 = now_sec();
+        for (int rep = 0; rep < reps; rep++)
+            for (int k = 0; k < CORPUS; k++) solved += solver_solve_from(&v, &corpus[k], R / 2, C / 2);
+        double ts = now_sec() - t0;
+
+        printf("%-8s %16.0f %12.1f %14.0f %9.1f%%\n", single ? "single" : "subset",
+               reps * CORPUS / td, (double)decided / (reps * CORPUS),
+               reps * CORPUS / ts, 100.0 * solved / (reps * CORPUS));
+        solver_free(&v);
+    }
+    for (int k = 0; k < CORPUS; k++) board_free(&corpus[k]);
+    free(corpus);
+    return 0;
+}
+
+/* ── Mine probabilities (Mayın olasılıkları) ─────────────────────────── */
+/* Probabilities by trying every layout — small boards only (kaba kuvvet) */
+static void prob_brute(const Board *b, double *p) {
+    const int R = b->rows, C = b->cols, n = R * C;
+    double total = 0;
+    for (int i = 0; i < n; i++) p[i] = 0;
+    for (uint32_t m = 0; m < (1u << n); m++) {
+        if (__builtin_popcount(m) != b->mines) continue;
+        bool ok = true;
+        for (int i = 0; i < n && ok; i++) {
+            uint8_t v = board_cell(b, i / C, i % C);
+            if (!(v & CELL_REVEALED)) continue;
+            if ((m >> i) & 1) { ok = false; break; }
+            int cnt = 0;
+            for (int dr = -1; dr <= 1; dr++)
+                for (int dc = -1; dc <= 1; dc++) {
+                    int rr = i / C + dr, cc = i % C + dc;
+                    if ((dr || dc) && rr >= 0 && rr < R && cc >= 0 && cc < C) cnt += (m >> (rr * C + cc)) & 1;
+                }
+            ok = cnt == (v & CELL_COUNT);
+        }
+        if (!ok) continue;
+        total += 1;
+        for (int i = 0; i < n; i++) p[i] += (m >> i) & 1;
+    }
+    for (int i = 0; i < n; i++) p[i] /= total;
+}
+
+static int bench_prob(void) {
+    ProbEngine e = {0};
+    double p[4096], q[20];
+
+    /* Exactness on small boards (küçük tahtalarda kesinlik) */
+    int checked = 0;
+    for (uint64_t t = 0; t < 2000; t++) {
+        int R = 3 + (int)(t % 2), C = 3 + (int)(t / 2 % 2), n = R * C;
+        Board b = {0};
+        board_setup(&b, R, C, 1 + (int)(t % (uint64_t)(n / 3)));
+        b.seed = t;
+        board_place_mines(&b);
+        board_compute_neighbors(&b);
+        for (int k = 0; k < 1 + (int)(t % 3); k++) {
+            int i = (int)(rng_at(t, (uint64_t)k) % (uint64_t)n);
+            if (!board_mine(&b, i / C, i % C)) board_reveal(&b, i / C, i % C, NULL);
+        }
+        if (!prob_compute(&e, &b, false, p, NULL)) { fprintf(stderr, "seed %llu failed\n", (unsigned long long)t); return 1; }
+        prob_brute(&b, q);
+        for (int i = 0; i < n; i++)
+            if (fabs(p[i] - q[i]) > 1e-9) {
+                fprintf(stderr, "seed %llu cell %d: %.12f, brute force %.12f\n", (unsigned long long)t, i, p[i], q[i]);
+                return 1;
+            }
+        board_free(&b);
+        checked++;
+    }
+    printf("exact on %d small boards\n", checked);
+
+    /* Stuck positions on 30×30 (30×30'da tıkanmış konumlar) */
+    enum { N = 30, GAMES = 40 };
+    static const int density[] = {15, 20, 25};
+    Solver v = {0};
+    printf("%-8s %10s %10s %10s %10s %10s %10s\n", "density", "positions", "mean", "p99", "max", "frontier", "largest");
+    for (size_t d = 0; d < sizeof density / sizeof *density; d++) {
+        double times[4096];
+        int np = 0, front = 0, largest = 0;
+        for (int g = 0; g < GAMES && np < 4096; g++) {
+            Board b = {0};
+            board_setup(&b, N, N, N * N * density[d] / 100);
+            b.seed = 7000 + (uint64_t)g;
+            board_place_mines_around(&b, N / 2, N / 2);
+            board_compute_neighbors(&b);
+            board_reveal(&b, N / 2, N / 2, NULL);
+            Rng pick = rng_init(b.seed);
+            while (!board_won(&b) && np < 4096) {
+                /* Open what deduction proves; when stuck, time the engine and
+                   open a safe frontier cell (çıkarımla aç; tıkanınca ölç) */
+                solver_deduce(&v, &b, false);
+                bool progress = false;
+                for (int r = 0; r < N; r++)
+                    for (int c = 0; c < N; c++)
+                        if (solver_state(&v, r, c) == SOLVER_SAFE) { board_reveal(&b, r, c, NULL); progress = true; }
+                if (progress) continue;
+                ProbStats st;
+                double t0 = now_sec();
+                if (!prob_compute(&e, &b, false, p, &st)) { fprintf(stderr, "prob_compute failed\n"); return 1; }
+                times[np++] = now_sec() - t0;
+                front += st.frontier;
+                if (st.largest > largest) largest = st.largest;
+                int i;
+                do i = (int)rng_below(&pick, N * N);
+                while (board_revealed(&b, i / N, i % N) || board_mine(&b, i / N, i % N));
+                board_reveal(&b, i / N, i % N, NULL);
+            }
+            board_free(&b);
+        }
+        qsort(times, (size_t)np, sizeof *times, cmp_double);
+        double sum = 0;
+        for (int i = 0; i < np; i++) sum += times[i];
+        char name[16];
+        snprintf(name, sizeof name, "%d%%", density[d]);
+        printf("%-8s %10d %8.2fms %8.2fms %8.2fms %10.1f %10d\n", name, np, sum / np * 1e3,
+               times[np * 99 / 100] * 1e3, times[np - 1] * 1e3, (double)front / np, largest);
+    }
+    solver_free(&v);
+    prob_free(&e);
+    return 0;
+}
+
+/* ── Monte Carlo games (Monte Carlo oyunları) ────────────────────────── */
+static int bench_sim(const char *strategy, uint64_t games, int threads) {
+    static const struct { const char *name; int rows, cols, mines; } config[] = {
+        {"beginner",     9,  9,  10},
+        {"intermediate", 16, 16, 40},
+        {"expert",       16, 30, 99},
+        {"30x30 20%",    30, 30, 180},
+    };
+    const SimStrategy *st = sim_strategy(strategy);
+    if (!st) { fprintf(stderr, "unknown strategy '%s' (random, solver, prob)\n", strategy); return 2; }
+    printf("strategy %s, %llu games per configuration\n", st->name, (unsigned long long)games);
+    printf("%-13s %8s %9s %9s %8s %14s\n", "config", "threads", "win rate", "mean 3BV", "clicks", "games/s");
+    for (size_t i = 0; i < sizeof config / sizeof *config; i++) {
+        SimConfig cfg = {config[i].rows, config[i].cols, config[i].mines, games, 1, threads};
+        SimResult res;
+        double t0 = now_sec();
+        if (!sim_run(&cfg, st, &res)) { fprintf(stderr, "%s: out of memory\n", config[i].name); return 1; }
+        double t = now_sec() - t0;
+        printf("%-13s %8d %8.2f%% %9.2f %8.2f %14.0f\n", config[i].name, res.threads,
+               100.0 * res.wins / res.games, (double)res.sum_3bv / res.games,
+               (double)res.clicks / res.games, res.games / t);
+
+        /* Results must not depend on the thread count (sonuç iş parçacığı sayısından bağımsız) */
+        SimConfig one = cfg;
+        one.threads = 1;
+        one.games   = games < 2000 ? games : 2000;
+        SimResult a, b;
+        cfg.games = one.games;
+        if (!sim_run(&one, st, &a) || !sim_run(&cfg, st, &b)
+            || a.wins != b.wins || a.sum_3bv != b.sum_3bv || a.clicks != b.clicks) {
+            fprintf(stderr, "%s: thread count changed the results\n", config[i].name);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* ── Regression suite (Gerileme takımı) ──────────────────────────────── */
+/*
+ * Each case times `op` on a board prepared by `prep` (untimed). Ops too
+ * short for the clock run `batch` times per sample. Sampling stops after
+ * `samples` samples or half a second, whichever comes first.
+ * (Her durum, hazırlanan tahtada op'u ölçer; çok kısa işlemler örnek
+ *  başına `batch` kez çalışır.)
+ */
+typedef struct {
+    const char *name;
+    bool        dense;        /* repeated for every density (her yoğunlukta) */
+    int         batch;
+    void      (*prep)(Board *b, int sample);
+    void      (*op)(Board *b, int sample);
+} SuiteCase;
+
+static volatile int suite_sink;
+
+static void prep_reset(Board *b, int sample) {
+    board_setup(b, b->rows, b->cols, b->mines);
+    (void)sample;
+}
+static void prep_dealt(Board *b, int sample) {
+    board_setup(b, b->rows, b->cols, b->mines);
+    b->seed = (uint64_t)sample + 1;
+    board_place_mines(b);
+    board_compute_neighbors(b);
+}
+static void prep_played(Board *b, int sample) {
+    prep_dealt(b, sample);
+    for (int r = 0; r < b->rows; r += 7)
+        for (int c = 0; c < b->cols; c += 7)
+            if (!board_mine(b, r, c)) board_reveal(b, r, c, NULL);
+}
+static void prep_empty(Board *b, int sample) {
+    clear_revealed(b);
+    (void)sample;
+}
+
+static void op_place(Board *b, int sample)     { b->seed = (uint64_t)sample + 1; board_place_mines(b); }
+static void op_neighbors(Board *b, int sample) { board_compute_neighbors(b); (void)sample; }
+static void op_reveal(Board *b, int sample)    { board_reveal(b, b->rows / 2, b->cols / 2, NULL); (void)sample; }
+static void op_reset(Board *b, int sample)     { board_setup(b, b->rows, b->cols, b->mines); (void)sample; }
+static void op_check_win(Board *b, int sample) { suite_sink += board_won(b); (void)sample; }
+
+static int bench_suite(int samples) {
+    static const struct { int rows, cols; } sizes[] = {
+        {9, 9}, {16, 30}, {30, 30}, {256, 256}, {1024, 1024},
+    };
+    static const double density[] = {0.01, 0.12, 0.20};
+    static const SuiteCase cases[] = {
+        {"place_mines",       true,  1,    prep_reset,  op_place},
+        {"compute_neighbors", true,  1,    prep_dealt,  op_neighbors},
+        {"reveal_all_zero",   false, 1,    prep_empty,  op_reveal},
+        {"init_game_reset",   true,  1,    prep_played, op_reset},
+        {"check_win",         false, 1024, prep_played, op_check_win},
+    };
+    if (samples < 1) samples = 200;
+    double *t = malloc((size_t)samples * sizeof *t);
+    if (!t) { fprintf(stderr, "out of memory\n"); return 1; }
+
+    printf("{\n  \"unit\": \"ns\",\n  \"results\": [");
+    const char *sep = "\n";
+    for (size_t k = 0; k < sizeof cases / sizeof *cases; k++)
+        for (size_t z = 0; z < sizeof sizes / sizeof *sizes; z++)
+            for (size_t d = 0; d < (cases[k].dense ? sizeof density / sizeof *density : 1); d++) {
+                const SuiteCase *sc = &cases[k];
+                int R = sizes[z].rows, C = sizes[z].cols;
+                double dens = sc->dense ? density[d] : 0.0;
+                int mines = (int)((double)R * C * dens + 0.5);
+                Board b = {0};
+                if (!board_setup(&b, R, C, mines)) { fprintf(stderr, "out of memory at %dx%d\n", R, C); return 1; }
+
+                int n = 0;
+                double spent = 0;
+                while (n < samples && (n < 10 || spent < 0.5)) {
+                    sc->prep(&b, n);
+                    double t0 = now_sec();
+                    for (int i = 0; i < sc->batch; i++) sc->op(&b, n);
+                    double dt = now_sec() - t0;
+                    spent += dt;
+                    t[n++] = dt / sc->batch * 1e9;
+                }
+                qsort(t, (size_t)n, sizeof *t, cmp_double);
+                int p99 = (int)ceil(0.99 * n) - 1;
+                printf("%s    {\"routine\": \"%s\", \"rows\": %d, \"cols\": %d, \"density\": %.2f, "
+                       "\"mines\": %d, \"samples\": %d, \"batch\": %d, "
+                       "\"min\": %.1f, \"median\": %.1f, \"p99\": %.1f}",
+                       sep, sc->name, R, C, dens, mines, n, sc->batch, t[0], t[n / 2], t[p99]);
+                sep = ",\n";
+                fflush(stdout);
+                board_free(&b);
+            }
+    printf("\n  ]\n}\n");
+    free(t);
+    return 0;
+}
+
+/* ── Replays (Tekrar kayıtları) ──────────────────────────────────────── */
+static int replay_files(int n, char **files) {
+    Board b = {0};
+    int bad = 0;
+    for (int i = 0; i < n; i++) {
+        FILE *f = fopen(files[i], "rb");
+        uint8_t *data = NULL;
+        long len = -1;
+        if (f && fseek(f, 0, SEEK_END) == 0 && (len = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0
+            && (data = malloc((size_t)len + 1)) && fread(data, 1, (size_t)len, f) != (size_t)len) len = -1;
+        if (f) fclose(f);
+        Replay rp;
+        bool ok = len >= 0 && replay_decode(&rp, data, (size_t)len);
+        bool same = ok && replay_verify(&rp, &b);
+        printf("%s: %s", files[i], !ok ? "unreadable" : same ? "ok" : "outcome differs");
+        if (ok) printf(" (%dx%d/%d, %zu events, %s)", rp.rows, rp.cols, rp.mines, rp.n_events,
+                       rp.outcome == REPLAY_WON ? "won" : rp.outcome == REPLAY_LOST ? "lost" : "unfinished");
+        printf("\n");
+        bad += !same;
+        if (ok) replay_free(&rp);
+        free(data);
+    }
+    board_free(&b);
+    return bad ? 1 : 0;
+}
+
+/* Every cell byte of a and b agree (tüm hücreler aynı mı) */
+static bool same_cells(const Board *a, const Board *b) {
+    for (int r = 0; r < a->rows; r++)
+        for (int c = 0; c < a->cols; c++)
+            if (board_cell(a, r, c) != board_cell(b, r, c)) return false;
+    return a->revealed_count == b->revealed_count && a->exploded == b->exploded;
+}
+
+/* Flags placed before a deferred deal, some toggled twice, then the deal
+   around the first click, a few moves and undo past the deal; the log
+   must replay to the same board (ertelenen dağıtımdan önce bayraklar) */
+static int replay_deferred(int games) {
+    Board b = {0}, v = {0};
+    Journal jr = {0};
+    ChangeSet cs = {0};
+    int bad = 0;
+    for (int g = 0; g < games && !bad; g++) {
+        board_setup(&b, 16, 30, 99);
+        b.seed = (uint64_t)g + 1;
+        journal_clear(&jr);
+        Rng rng = rng_init(rng_stream(7, (uint64_t)g));
+        for (int f = 0, n = 1 + (int)rng_below(&rng, 12); f < n; f++) {
+            int fr = (int)rng_below(&rng, 16), fc = (int)rng_below(&rng, 30);
+            changes_clear(&cs);
+            if (board_toggle_flag(&b, fr, fc, &cs)) journal_push(&jr, &b, JOURNAL_FLAG, &cs);
+        }
+        int r = (int)rng_below(&rng, 16), c = (int)rng_below(&rng, 30);
+        board_place_mines_around(&b, r, c);
+        board_compute_neighbors(&b);
+        Replay rp = {0};
+        replay_begin(&rp, &b, r, c);
+        replay_adopt_flags(&rp, &b, &jr);
+        uint64_t t = 0;
+        for (int m = 0; m < 6 && !b.exploded; m++, r = (int)rng_below(&rng, 16), c = (int)rng_below(&rng, 30)) {
+            changes_clear(&cs);
+            if (board_reveal(&b, r, c, &cs)) journal_push(&jr, &b, JOURNAL_REVEAL, &cs);
+            replay_record(&rp, REPLAY_REVEAL, r, c, t += 100);
+        }
+        while (rng_below(&rng, 4) && journal_undo(&jr, &b, NULL)) replay_record(&rp, REPLAY_UNDO, 0, 0, t);
+        replay_finish(&rp, &b);
+        size_t len;
+        uint8_t *file = replay_encode(&rp, 0, &len);
+        Replay back;
+        bad = !file || !replay_decode(&back, file, len) || !replay_verify(&back, &v) || !same_cells(&b, &v);
+        if (file && !bad) replay_free(&back);
+        free(file);
+        replay_free(&rp);
+    }
+    printf("deferred deals with flags placed first: %d games, %s\n", games, bad ? "replayed differently" : "ok");
+    journal_free(&jr);
+    changes_free(&cs);
+    board_free(&b); board_free(&v);
+    return bad;
+}
+
+static int bench_replay(int argc, char **argv) {
+    if (argc > 0) return replay_files(argc, argv);
+    if (replay_deferred(500)) return 1;
+    static const struct { const char *name; int rows, cols, mines, games; } config[] = {
+        {"expert",    16, 30, 99, 500},
+        {"30x30 20%", 30, 30, 180, 500},
+        {"256x256",   256, 256, 8000, 50},
+    };
+    const SimStrategy *st = &sim_solver;
+    void *state = st->start();
+    printf("recorded games played by the solver strategy, with stray flags; odd games also undo and redo\n");
+    printf("%-10s %10s %12s %10s %14s %12s\n", "config", "events", "bytes/event", "keyframes",
+           "replay ev/s", "seek");
+    for (size_t k = 0; k < sizeof config / sizeof *config; k++) {
+        int R = config[k].rows, C = config[k].cols, games = config[k].games;
+        size_t events = 0, bytes = 0, keys = 0, seeks = 0;
+        double t_replay = 0, t_seek = 0;
+        Board b = {0}, v = {0}, w = {0};
+        for (int g = 0; g < games; g++) {
+            board_setup(&b, R, C, config[k].mines);
+            b.seed = (uint64_t)g + 1;
+            board_place_mines(&b);
+            board_compute_neighbors(&b);
+            Replay rp = {0};
+            replay_begin(&rp, &b, -1, -1);
+            Rng rng = rng_init(rng_stream(99, (uint64_t)g));
+            uint64_t t = 0;
+            int r, c;
+            Journal jr = {0};
+            ChangeSet cs = {0};
+            bool undo = g & 1;                              /* odd games undo too (tek oyunlar geri alır) */
+            st->new_game(state);
+            while (!b.exploded && !board_won(&b) && st->pick(state, &b, &rng, &r, &c)) {
+                t += 50 + rng_below(&rng, 2000);
+                int fr = (int)rng_below(&rng, (uint64_t)R), fc = (int)rng_below(&rng, (uint64_t)C);
+                for (int f = 0; f < 2; f++) {               /* a stray flag, then one in the way (bayraklar) */
+                    changes_clear(&cs);
+                    if (f == 0 ? rng_below(&rng, 8) == 0 && board_toggle_flag(&b, fr, fc, &cs)
+                               : board_flagged(&b, r, c) && board_toggle_flag(&b, r, c, &cs)) {
+                        journal_push(&jr, &b, JOURNAL_FLAG, &cs);
+                        replay_record(&rp, REPLAY_FLAG, f == 0 ? fr : r, f == 0 ? fc : c, t);
+                    }
+                }
+                changes_clear(&cs);
+                bool opened = board_reveal(&b, r, c, &cs) > 0;
+                if (opened) journal_push(&jr, &b, JOURNAL_REVEAL, &cs);
+                replay_record(&rp, REPLAY_REVEAL, r, c, t);
+                if (!undo || b.exploded || rng_below(&rng, 4)) continue;
+
+                /* Undo a few actions and redo them, or take back this
+                   reveal and click it again (geri al ve yinele) */
+                if (opened && rng_below(&rng, 2)) {
+                    journal_undo(&jr, &b, NULL);
+                    replay_record(&rp, REPLAY_UNDO, 0, 0, t);
+                    changes_clear(&cs);
+                    if (board_reveal(&b, r, c, &cs)) journal_push(&jr, &b, JOURNAL_REVEAL, &cs);
+                    replay_record(&rp, REPLAY_REVEAL, r, c, t);
+                    continue;
+                }
+                int n = 1 + (int)rng_below(&rng, 3), done = 0;
+                while (done < n && journal_undo(&jr, &b, NULL)) { replay_record(&rp, REPLAY_UNDO, 0, 0, t); done++; }
+                while (done-- > 0 && journal_redo(&jr, &b, NULL)) replay_record(&rp, REPLAY_REDO, 0, 0, t);
+            }
+            replay_finish(&rp, &b);
+            journal_free(&jr);
+            changes_free(&cs);
+
+            size_t len;
+            uint8_t *file = replay_encode(&rp, 0, &len);
+            Replay back;
+            if (!file || !replay_decode(&back, file, len)) { fprintf(stderr, "%s: encode/decode failed\n", config[k].name); return 1; }
+            double t0 = now_sec();
+            bool ok = replay_verify(&back, &v);
+            t_replay += now_sec() - t0;
+            if (!ok || !same_cells(&b, &v)) { fprintf(stderr, "%s: game %d replayed differently\n", config[k].name, g); return 1; }
+
+            /* Seek to random moves, compared with replaying from the start
+               (rastgele hamlelere atla, baştan oynatmayla karşılaştır) */
+            for (int s = 0; s < 4 && back.n_events; s++) {
+                size_t m = (size_t)rng_below(&rng, back.n_events + 1);
+                t0 = now_sec();
+                replay_seek(&back, &v, m);
+                t_seek += now_sec() - t0;
+                seeks++;
+                Replay from0 = back;
+                from0.n_keys = 0;
+                replay_seek(&from0, &w, m);
+                if (!same_cells(&v, &w)) { fprintf(stderr, "%s: seek to %zu differs\n", config[k].name, m); return 1; }
+            }
+            events += back.n_events;
+            bytes  += len;
+            keys   += back.n_keys;
+            replay_free(&back);
+            replay_free(&rp);
+            free(file);
+        }
+        printf("%-10s %10zu %12.2f %10zu %14.0f %10.1fus\n", config[k].name, events, (double)bytes / events,
+               keys, events / t_replay, t_seek / seeks * 1e6);
+        board_free(&b); board_free(&v); board_free(&w);
+    }
+    st->stop(state);
+    return 0;
+}
+
+/* ── Snapshots (Anlık görüntüler) ────────────────────────────────────── */
+static int bench_snapshot(void) {
+    static const int sizes[] = {30, 256, 1024, 4096, 10000};
+    printf("%-13s %10s %10s %10s %10s %12s\n", "board", "image", "encode", "restore", "recount", "chunks");
+    for (size_t k = 0; k < sizeof sizes / sizeof *sizes; k++) {
+        int n = sizes[k];
+        Board b = {0}, back = {0};
+        if (!board_setup(&b, n, n, (int)((long long)n * n / 10))) { fprintf(stderr, "out of memory at %dx%d\n", n, n); return 1; }
+        b.seed = 7;
+        board_place_mines(&b);
+        double t0 = now_sec();
+        board_compute_neighbors(&b);
+        double t_recount = now_sec() - t0;
+        Rng rng = rng_init(11);
+        for (int i = 0; i < 64; i++) {
+            int r = (int)rng_below(&rng, (uint64_t)n), c = (int)rng_below(&rng, (uint64_t)n);
+            if (board_mine(&b, r, c)) board_toggle_flag(&b, r, c, NULL);
+            else                      board_reveal(&b, r, c, NULL);
+        }
+
+        size_t len;
+        SnapInfo info = {123456, (const uint8_t *)"extra", 5, 4321}, got;
+        t0 = now_sec();
+        uint8_t *image = snapshot_encode(&b, &info, &len);
+        double t1 = now_sec();
+        if (!image || !snapshot_restore(&back, image, len, &got)) { fprintf(stderr, "%dx%d: snapshot failed\n", n, n); return 1; }
+        double t2 = now_sec();
+        if (!same_cells(&b, &back) || back.seed != b.seed || back.mines != b.mines || got.elapsed_ms != info.elapsed_ms
+            || got.extra_len != 5 || memcmp(got.extra, "extra", 5) != 0 || got.bv != info.bv) {
+            fprintf(stderr, "%dx%d: restored board differs\n", n, n);
+            return 1;
+        }
+        char name[24], chunks[24];
+        snprintf(name, sizeof name, "%dx%d", n, n);
+        snprintf(chunks, sizeof chunks, "%zu/%zu", back.chunks_live, (size_t)b.chunk_rows * b.chunk_cols);
+        printf("%-13s %7.1fMiB %8.2fms %8.2fms %8.2fms %12s\n", name, len / 1048576.0,
+               (t1 - t0) * 1e3, (t2 - t1) * 1e3, t_recount * 1e3, chunks);
+        free(image);
+        board_free(&b);
+        board_free(&back);
+    }
+    return 0;
+}
+
+/* ── Undo journal (Geri alma günlüğü) ────────────────────────────────── */
+static size_t gcd(size_t a, size_t b) {
+    while (b) { size_t t = a % b; a = b; b = t; }
+    return a;
+}
+
+static int bench_undo(void) {
+    static const int sizes[] = {30, 256, 1024, 4096};
+    printf("%-11s %8s %10s %10s %10s %10s %10s\n", "board", "actions", "cells", "journal", "board", "undo all", "per cell");
+    for (size_t k = 0; k < sizeof sizes / sizeof *sizes; k++) {
+        int n = sizes[k];
+        Board b = {0};
+        Journal j = {0};
+        ChangeSet cs = {0};
+        board_setup(&b, n, n, (int)((long long)n * n * 12 / 100));
+        b.seed = 5;
+        board_place_mines(&b);
+        board_compute_neighbors(&b);
+        /* i * step mod n² visits every cell once for step coprime to n²
+           (her hücre bir kez ziyaret edilir) */
+        size_t cells = (size_t)n * n, step = 2654435761u % cells;
+        while (gcd(step, cells) != 1) step++;
+        for (size_t i = 0, at = 0; i < cells; i++, at = (at + step) % cells) {
+            int r = (int)(at / (size_t)n), c = (int)(at % (size_t)n);
+            changes_clear(&cs);
+            if (!board_mine(&b, r, c)) {
+                if (board_reveal(&b, r, c, &cs)) journal_push(&j, &b, JOURNAL_REVEAL, &cs);
+            } else if (i & 1) {
+                if (board_toggle_flag(&b, r, c, &cs)) journal_push(&j, &b, JOURNAL_FLAG, &cs);
+            }
+        }
+        if (!board_won(&b)) { fprintf(stderr, "%dx%d: board not cleared\n", n, n); return 1; }
+
+        size_t before_len, after_len;
+        SnapInfo info = {0};
+        uint8_t *before = snapshot_encode(&b, &info, &before_len);
+        double t0 = now_sec();
+        while (journal_undo(&j, &b, &cs)) changes_clear(&cs);
+        double t_undo = now_sec() - t0;
+        bool empty = b.revealed_count == 0 && !b.exploded;
+        for (int i = 0; i < n && empty; i++)
+            for (int x = 0; x < n; x++)
+                if (board_cell(&b, i, x) & (CELL_REVEALED | CELL_FLAGGED)) { empty = false; break; }
+        while (journal_redo(&j, &b, NULL)) {}
+        uint8_t *after = snapshot_encode(&b, &info, &after_len);
+        if (!empty || !before || !after || before_len != after_len || memcmp(before, after, before_len) != 0) {
+            fprintf(stderr, "%dx%d: undo/redo did not restore the board\n", n, n);
+            return 1;
+        }
+
+        char name[24];
+        snprintf(name, sizeof name, "%dx%d", n, n);
+        printf("%-11s %8zu %10zu %7.1fKiB %7.1fKiB %8.2fms %8.1fns\n", name, j.n_acts, j.n_cells,
+               (j.n_cells * sizeof *j.cells + j.n_acts * sizeof *j.acts) / 1024.0,
+               b.chunks_live * sizeof(Chunk) / 1024.0, t_undo * 1e3, j.n_cells ? t_undo * 1e9 / j.n_cells : 0.0);
+        free(before);
+        free(after);
+        journal_free(&j);
+        changes_free(&cs);
+        board_free(&b);
+    }
+    return 0;
+}
+
+/* ── Preset kernels (Hazır boyut çekirdekleri) ───────────────────────── */
+/* Count, then click every safe cell in a scattered order; seconds spent
+   in each part (say, sonra her güvenli hücreye tıkla) */
+static void preset_game(Board *b, uint64_t seed, bool generic, double *t_count, double *t_reveal) {
+    board_setup(b, b->rows, b->cols, b->mines);
+    if (generic) b->kern = NULL;
+    b->seed = seed;
+    board_place_mines(b);
+    double t0 = now_sec();
+    board_compute_neighbors(b);
+    double t1 = now_sec();
+    size_t cells = (size_t)b->rows * b->cols, step = 7;
+    while (gcd(step, cells) != 1) step += 2;
+    for (size_t i = 0, at = seed % cells; i < cells; i++, at = (at + step) % cells) {
+        int r = (int)(at / (size_t)b->cols), c = (int)(at % (size_t)b->cols);
+        if (!board_mine(b, r, c)) board_reveal(b, r, c, NULL);
+    }
+    *t_count  += t1 - t0;
+    *t_reveal += now_sec() - t1;
+}
+
+static int bench_presets(void) {
+    static const struct { const char *name; int rows, cols, mines; } presets[] = {
+#define PRESET_ROW(name, R, C, M) {#name, R, C, M},
+        BOARD_PRESETS(PRESET_ROW)
+#undef PRESET_ROW
+    };
+    const int games = 2000;
+    printf("%d games per preset; ns per board, generic / preset\n", games);
+    printf("%-13s %20s %8s %20s %8s\n", "preset", "count neighbors", "speedup", "reveal whole game", "speedup");
+    for (size_t k = 0; k < sizeof presets / sizeof *presets; k++) {
+        Board g = {0}, p = {0};
+        board_setup(&g, presets[k].rows, presets[k].cols, presets[k].mines);
+        board_setup(&p, presets[k].rows, presets[k].cols, presets[k].mines);
+        if (!p.kern) { fprintf(stderr, "%s: no preset kernels\n", presets[k].name); return 1; }
+        double gc = 0, gr = 0, pc = 0, pr = 0;
+        for (int i = 0; i < games; i++) {
+            preset_game(&g, (uint64_t)i + 1, true,  &gc, &gr);
+            preset_game(&p, (uint64_t)i + 1, false, &pc, &pr);
+            if (!same_cells(&g, &p) || !board_won(&p)) {
+                fprintf(stderr, "%s: seed %d differs between generic and preset code\n", presets[k].name, i + 1);
+                return 1;
+            }
+        }
+        printf("%-13s %9.0f / %8.0f %7.2fx %9.0f / %8.0f %7.2fx\n", presets[k].name,
+               gc * 1e9 / games, pc * 1e9 / games, gc / pc, gr * 1e9 / games, pr * 1e9 / games, gr / pr);
+        board_free(&g);
+        board_free(&p);
+    }
+    return 0;
+}
+
+/* ── Parallel flood (Paralel açma) ───────────────────────────────────── */
+/* Hide every cell again, keeping the chunks (tüm hücreleri yeniden gizle) */
+static void hide_all(Board *b) {
+    for (size_t i = 0; i < (size_t)b->chunk_rows * b->chunk_cols; i++)
+        if (b->chunks[i])
+            for (int j = 0; j < CHUNK_CELLS; j++) b->chunks[i]->cell[j] &= (uint8_t)~CELL_REVEALED;
+    b->revealed_count = 0;
+}
+
+static int cmp_change(const void *x, const void *y) {
+    const CellChange *a = x, *b = y;
+    if (a->r != b->r) return a->r < b->r ? -1 : 1;
+    if (a->c != b->c) return a->c < b->c ? -1 : 1;
+    return (int)a->cell - (int)b->cell;
+}
+
+/* Same cells and bytes in any order, same bounding box (sırasız eşitlik) */
+static bool same_changes(ChangeSet *a, ChangeSet *b) {
+    if (a->n != b->n || a->oom || b->oom) return false;
+    if (!a->n) return true;
+    if (a->r0 != b->r0 || a->c0 != b->c0 || a->r1 != b->r1 || a->c1 != b->c1) return false;
+    qsort(a->cells, a->n, sizeof *a->cells, cmp_change);
+    qsort(b->cells, b->n, sizeof *b->cells, cmp_change);
+    for (size_t i = 0; i < a->n; i++)
+        if (cmp_change(&a->cells[i], &b->cells[i])) return false;
+    return true;
+}
+
+static bool deal(Board *b, int rows, int cols, int mines, uint64_t seed) {
+    if (!board_setup(b, rows, cols, mines)) return false;
+    b->seed = seed;
+    board_place_mines(b);
+    board_compute_neighbors(b);
+    return true;
+}
+
+static int bench_flood(int threads) {
+    if (threads <= 0) threads = thread_cpu_count();
+
+    /* Exactness (Kesinlik) */
+    static const int density[] = {2, 5, 10, 15};
+    ChangeSet cs = {0}, cp = {0};
+    int clicks = 0;
+    for (size_t d = 0; d < sizeof density / sizeof *density; d++)
+        for (uint64_t seed = 1; seed <= 20; seed++) {
+            const int R = 300, C = 500;
+            Board s = {0}, p = {0};
+            if (!deal(&s, R, C, R * C * density[d] / 100, seed) || !deal(&p, R, C, s.mines, seed)) {
+                fprintf(stderr, "out of memory\n");
+                return 1;
+            }
+            Rng g = rng_init(seed);
+            for (int i = 0; i < R * C / 100; i++) {
+                int r = (int)rng_below(&g, R), c = (int)rng_below(&g, C);
+                board_toggle_flag(&s, r, c, NULL);
+                board_toggle_flag(&p, r, c, NULL);
+            }
+            for (int i = 0; i < 40; i++, clicks++) {
+                int r = (int)rng_below(&g, R), c = (int)rng_below(&g, C);
+                changes_clear(&cs);
+                changes_clear(&cp);
+                int ns = board_reveal(&s, r, c, &cs);
+                int np = board_reveal_parallel(&p, r, c, 4, &cp);
+                if (ns != np || !same_cells(&s, &p) || !same_changes(&cs, &cp)) {
+                    fprintf(stderr, "%d%% seed %llu: click %d at (%d, %d) differs (%d vs %d cells)\n", density[d],
+                            (unsigned long long)seed, i, r, c, ns, np);
+                    return 1;
+                }
+            }
+            board_free(&s);
+            board_free(&p);
+        }
+    changes_free(&cs);
+    changes_free(&cp);
+    printf("%d clicks on 300x500 boards identical to the serial reveal\n\n", clicks);
+
+    /* Scaling (Ölçekleme) */
+    static const int sizes[] = {2048, 4096, 10000};
+    printf("%-11s %10s %10s", "board", "opened", "serial");
+    for (int t = 2; t < threads * 2; t *= 2) printf(" %8d thr", t < threads ? t : threads);
+    printf("\n");
+    for (size_t k = 0; k < sizeof sizes / sizeof *sizes; k++) {
+        int n = sizes[k];
+        Board s = {0}, p = {0};
+        if (!deal(&s, n, n, (int)((long long)n * n / 1000), 1) || !deal(&p, n, n, s.mines, 1)) {
+            fprintf(stderr, "out of memory at %dx%d\n", n, n);
+            return 1;
+        }
+        int r = n / 2, c = n / 2;
+        while (board_cell(&s, r, c) & (CELL_MINE | CELL_COUNT)) c = (c + 1) % n;
+
+        /* Best of three; the first run allocates the chunks (üçün en iyisi) */
+        int opened = board_reveal(&s, r, c, NULL);
+        double serial = 1e9;
+        for (int i = 0; i < 3; i++) {
+            hide_all(&s);
+            double t0 = now_sec();
+            board_reveal(&s, r, c, NULL);
+            double t = now_sec() - t0;
+            if (t < serial) serial = t;
+        }
+        char name[24];
+        snprintf(name, sizeof name, "%dx%d", n, n);
+        printf("%-11s %10d %8.1fms", name, opened, serial * 1e3);
+        fflush(stdout);
+
+        for (int t = 2; t < threads * 2; t *= 2) {
+            int w = t < threads ? t : threads;
+            double best = 1e9;
+            for (int i = 0; i < 3; i++) {
+                hide_all(&p);
+                double t0 = now_sec();
+                int got = board_reveal_parallel(&p, r, c, w, NULL);
+                double el = now_sec() - t0;
+                if (el < best) best = el;
+                if (got != opened || !same_cells(&s, &p)) {
+                    fprintf(stderr, "\n%s: %d threads opened %d cells, serial %d\n", name, w, got, opened);
+                    return 1;
+                }
+            }
+            printf(" %6.1fms %4.2fx", best * 1e3, serial / best);
+            fflush(stdout);
+        }
+        printf("\n");
+        board_free(&s);
+        board_free(&p);
+    }
+    return 0;
+}
+
+/* ── Opening index (Açıklık dizini) ───────────────────────────────────── */
+static int bench_openings(void) {
+    static const struct { const char *name; int rows, cols, mines; } config[] = {
+        {"expert",    16,   30,    99},
+        {"256x256",   256,  256,   6554},
+        {"1024x1024", 1024, 1024,  52429},
+        {"4096x4096", 4096, 4096,  167772},
+    };
+
+    /* Exactness, flags toggled between clicks (kesinlik, tıklamalar arası bayraklar) */
+    ChangeSet cs = {0}, co = {0};
+    Openings  o  = {0};
+    long clicks = 0, indexed = 0;
+    for (size_t k = 0; k < 3; k++)
+        for (uint64_t seed = 1; seed <= 30; seed++) {
+            const int R = config[k].rows, C = config[k].cols;
+            Board s = {0}, p = {0};
+            if (!deal(&s, R, C, config[k].mines, seed) || !deal(&p, R, C, s.mines, seed) || !openings_build(&o, &p)) {
+                fprintf(stderr, "out of memory\n");
+                return 1;
+            }
+            size_t zeros = 0;
+            for (size_t i = 0; i < o.count; i++) zeros += o.open[i].zeros;
+            for (int r = 0; r < R; r++)
+                for (int c = 0; c < C; c++) zeros -= !(board_cell(&p, r, c) & (CELL_COUNT | CELL_MINE));
+            if (zeros) { fprintf(stderr, "%s seed %llu: zero cells miscounted\n", config[k].name, (unsigned long long)seed); return 1; }
+
+            Rng g = rng_init(seed);
+            for (int i = 0; i < 200; i++, clicks++) {
+                int r = (int)rng_below(&g, R), c = (int)rng_below(&g, C);
+                if (rng_below(&g, 4) == 0) {
+                    board_toggle_flag(&s, r, c, NULL);
+                    board_toggle_flag(&p, r, c, NULL);
+                    continue;
+                }
+                changes_clear(&cs);
+                changes_clear(&co);
+                indexed += openings_at(&o, r, c) >= 0;
+                int ns = board_reveal(&s, r, c, &cs);
+                int np = openings_reveal(&o, &p, r, c, &co);
+                if (ns != np || !same_cells(&s, &p) || !same_changes(&cs, &co)) {
+                    fprintf(stderr, "%s seed %llu: click %d at (%d, %d) differs (%d vs %d cells)\n", config[k].name,
+                            (unsigned long long)seed, i, r, c, ns, np);
+                    return 1;
+                }
+            }
+            board_free(&s);
+            board_free(&p);
+        }
+    printf("%ld reveals (%ld on indexed zeros) identical to board_reveal\n\n", clicks, indexed);
+
+    /* Build and reveal cost (Kurma ve açma maliyeti) */
+    printf("%-11s %9s %9s %11s %11s %9s %13s %13s\n", "board", "openings", "largest", "mean size",
+           "neighbors", "index", "flood/cell", "index/cell");
+    for (size_t k = 0; k < sizeof config / sizeof *config; k++) {
+        const int R = config[k].rows, C = config[k].cols;
+        const int reps = R * C < 100000 ? 2000 : R * C < 2000000 ? 10 : 1;
+        double t_count = 0, t_index = 0, t_flood = 0, t_list = 0;
+        size_t opened = 0, largest = 0, cells = 0, count = 0;
+        for (int i = 0; i < reps; i++) {
+            Board s = {0}, p = {0};
+            deal(&s, R, C, config[k].mines, (uint64_t)i + 1);
+            deal(&p, R, C, s.mines, (uint64_t)i + 1);
+            double t0 = now_sec();
+            board_compute_neighbors(&p);
+            double t1 = now_sec();
+            if (!openings_build(&o, &p)) { fprintf(stderr, "out of memory\n"); return 1; }
+            double t2 = now_sec();
+            t_count += t1 - t0;
+            t_index += t2 - t1;
+
+            /* One click per opening, on its first zero (açıklık başına bir tıklama) */
+            double t3 = now_sec();
+            for (size_t j = 0; j < o.count; j++) {
+                uint32_t z = o.runs[o.open[j].run].at;
+                opened += (size_t)board_reveal(&s, (int)(z / (uint32_t)C), (int)(z % (uint32_t)C), NULL);
+            }
+            double t4 = now_sec();
+            for (size_t j = 0; j < o.count; j++) {
+                uint32_t z = o.runs[o.open[j].run].at;
+                openings_reveal(&o, &p, (int)(z / (uint32_t)C), (int)(z % (uint32_t)C), NULL);
+            }
+            t_flood += t4 - t3;
+            t_list  += now_sec() - t4;
+            if (!same_cells(&s, &p)) { fprintf(stderr, "%s: index opened different cells\n", config[k].name); return 1; }
+            for (size_t j = 0; j < o.count; j++) {
+                if (o.open[j].size > largest) largest = o.open[j].size;
+                cells += o.open[j].size;
+            }
+            count += o.count;
+            board_free(&s);
+            board_free(&p);
+        }
+        printf("%-11s %9.0f %9zu %11.1f %9.2fms %7.2fms %10.2f ns %10.2f ns\n", config[k].name,
+               (double)count / reps, largest, count ? (double)cells / count : 0.0,
+               t_count * 1e3 / reps, t_index * 1e3 / reps,
+               opened ? t_flood * 1e9 / opened : 0.0, opened ? t_list * 1e9 / opened : 0.0);
+    }
+    changes_free(&cs);
+    changes_free(&co);
+    openings_free(&o);
+    return 0;
+}
+
+/* ── Board pool (Tahta havuzu) ───────────────────────────────────────── */
+static void wait_ready(BoardPool *p, uint64_t n) {
+    struct timespec ms = {0, 1000000};
+    while (pool_ready(p) < n) nanosleep(&ms, NULL);
+}
+
+static int bench_pool(void) {
+    static const struct { const char *name; int rows, cols, mines; } config[] = {
+        {"expert",      16,    30,    99},
+        {"1000x1000",   1000,  1000,  150000},
+        {"4096x4096",   4096,  4096,  167772},
+        {"10000x10000", 10000, 10000, 100000},
+    };
+    const size_t index_below = (size_t)1 << 20;       /* as the game does (oyundaki gibi) */
+    BoardPool pool;
+    if (!pool_start(&pool, 42, index_below)) { fprintf(stderr, "pool did not start\n"); return 1; }
+
+    printf("%-12s %6s %12s %12s %10s\n", "board", "ready", "deal", "take", "speedup");
+    Board b = {0}, v = {0};
+    Openings o = {0}, vo = {0};
+    Grader gr = {0};
+    uint32_t bv;
+    for (size_t k = 0; k < sizeof config / sizeof *config; k++) {
+        const int R = config[k].rows, C = config[k].cols, M = config[k].mines;
+        size_t cells = (size_t)R * C;
+        uint64_t ready = POOL_BUDGET / cells < 1 ? 1 : POOL_BUDGET / cells > POOL_SLOTS ? POOL_SLOTS : POOL_BUDGET / cells;
+        pool_want(&pool, R, C, M);
+
+        /* Synchronous New Game, while the pool fills (eşzamanlı yeni oyun) */
+        double t0 = now_sec();
+        deal(&v, R, C, M, 7);
+        if (cells < index_below) openings_build(&vo, &v);
+        double t_deal = now_sec() - t0;
+
+        /* Median take: on a busy core, waking the worker can preempt the
+           caller mid-take (ortanca; uyanan işçi çağıranı kesebilir) */
+        double t_take[3 * POOL_SLOTS];
+        int takes = 0;
+        for (int round = 0; round < 3; round++) {
+            wait_ready(&pool, ready);
+            for (uint64_t i = 0; i < ready; i++, takes++) {
+                double t1 = now_sec();
+                bool got = pool_take(&pool, R, C, M, &b, &o, &bv);
+                t_take[takes] = now_sec() - t1;
+                if (!got) { fprintf(stderr, "%s: no board ready\n", config[k].name); return 1; }
+                if (!deal(&v, R, C, M, b.seed) || !same_cells(&b, &v)) {
+                    fprintf(stderr, "%s: pooled board differs from its seed\n", config[k].name);
+                    return 1;
+                }
+                bool indexed = cells < index_below;
+                if (indexed && (!openings_build(&vo, &v) || o.rows != R || o.count != vo.count
+                                || o.n_runs != vo.n_runs || o.n_edges != vo.n_edges)) {
+                    fprintf(stderr, "%s: pooled index differs\n", config[k].name);
+                    return 1;
+                }
+                if (!indexed && o.rows) { fprintf(stderr, "%s: index built above the limit\n", config[k].name); return 1; }
+                Grade g;
+                if (round == 0 && (!grade_board(&gr, &v, 0, &g) || g.value[GRADE_3BV] != bv)) {
+                    fprintf(stderr, "%s: pooled 3BV differs\n", config[k].name);
+                    return 1;
+                }
+            }
+        }
+        qsort(t_take, (size_t)takes, sizeof *t_take, cmp_double);
+        double med = t_take[takes / 2];
+        printf("%-12s %6llu %10.3fms %10.3fus %9.0fx\n", config[k].name, (unsigned long long)ready,
+               t_deal * 1e3, med * 1e6, t_deal / med);
+        fflush(stdout);
+    }
+
+    /* A size change drops the old boards (boyut değişimi eskileri bırakır) */
+    pool_want(&pool, 16, 30, 99);
+    wait_ready(&pool, POOL_SLOTS);
+    pool_want(&pool, 16, 16, 40);
+    if (pool_take(&pool, 16, 30, 99, &b, &o, &bv)) { fprintf(stderr, "old size still served\n"); return 1; }
+    wait_ready(&pool, 1);
+    if (!pool_take(&pool, 16, 16, 40, &b, &o, &bv) || b.rows != 16 || b.cols != 16) {
+        fprintf(stderr, "new size not served\n");
+        return 1;
+    }
+    printf("size change: old boards dropped, new size served\n");
+
+    pool_stop(&pool);
+    board_free(&b);
+    board_free(&v);
+    openings_free(&o);
+    openings_free(&vo);
+    grade_free(&gr);
+    return 0;
+}
+
+/* ── Event tracing (Olay izleme) ─────────────────────────────────────── */
+#define TRACE_EVENTS 4000000
+
+static THREAD_RET trace_worker(void *arg) {
+    (void)arg;
+    for (uint32_t i = 0; i < TRACE_EVENTS / 2; i++) {
+        trace_event("bench", 'B', i);
+        trace_event("bench", 'E', 0);
+    }
+    trace_thread_exit();
+    return 0;
+}
+
+/* Events in a dump, counted from its JSON (dökümdeki olay sayısı) */
+static size_t trace_count(void) {
+    FILE *f = tmpfile();
+    if (!f || !trace_dump(f)) { if (f) fclose(f); return 0; }
+    rewind(f);
+    size_t n = 0;
+    char line[256];
+    while (fgets(line, sizeof line, f)) n += strstr(line, "\"ph\":") != NULL;
+    fclose(f);
+    return n;
+}
+
+/* No-guess expert deals, each played out by the solver strategy with
+   every click traced (tahminsiz uzman dağıtımları, çözücüyle oynanır) */
+static void trace_games(int games) {
+    const SimStrategy *st = sim_strategy("solver");
+    void *state = st->start ? st->start() : NULL;
+    Board b = {0};
+    ChangeSet cs = {0};
+    for (int g = 0; g < games; g++) {
+        board_setup(&b, 16, 30, 99);
+        b.seed = (uint64_t)g + 1;
+        trace_event("generate_no_guess", 'B', 0);
+        generate_no_guess(&b, 8, 15, 0, 200000, NULL);
+        trace_event("generate_no_guess", 'E', 0);
+        if (st->new_game) st->new_game(state);
+        Rng rng = rng_init(rng_stream(b.seed, 1));
+        int r = 8, c = 15;
+        do {
+            changes_clear(&cs);
+            trace_event("board_reveal", 'B', 0);
+            board_reveal(&b, r, c, &cs);
+            trace_event("board_reveal", 'E', (uint32_t)cs.n);
+        } while (!b.exploded && !board_won(&b) && st->pick(state, &b, &rng, &r, &c));
+    }
+    if (st->stop) st->stop(state);
+    changes_free(&cs);
+    board_free(&b);
+}
+
+static int bench_trace(const char *out) {
+    if (out) {
+        trace_games(20);
+        FILE *f = fopen(out, "w");
+        if (!f || !trace_dump(f) || fclose(f) != 0) { perror(out); return 1; }
+        printf("wrote %s: %zu events\n", out, trace_count());
+    }
+
+    /* The timestamp is most of an event's cost (zaman damgası maliyetin çoğu) */
+    double t0 = now_sec();
+    for (int i = 0; i < TRACE_EVENTS; i++) now_sec();
+    double clock = now_sec() - t0;
+    t0 = now_sec();
+    trace_worker(NULL);
+    double one = now_sec() - t0;
+
+    /* Two rounds of one thread per core, the main thread's ring given back
+       before them: the second round must reuse the first round's rings
+       (ikinci tur ilkinin halkalarını yeniden kullanmalı) */
+    int threads = thread_cpu_count();
+    if (threads > 64) threads = 64;
+    Thread t[64];
+    size_t dumped[2];
+    double all = 0;
+    for (int round = 0; round < 2; round++) {
+        int started = 0;
+        t0 = now_sec();
+        while (started < threads && thread_start(&t[started], trace_worker, NULL)) started++;
+        for (int i = 0; i < started; i++) thread_join(t[i]);
+        all = now_sec() - t0;
+        threads = started;
+        dumped[round] = trace_count();
+    }
+
+    const size_t ring = (size_t)1 << TRACE_RING_BITS;
+    printf("%-10s %8.2f ns (clock read alone %.2f ns)\n", "1 thread", one * 1e9 / TRACE_EVENTS,
+           clock * 1e9 / TRACE_EVENTS);
+    printf("%2d threads %8.2f ns each, %.0f M events/s in total\n", threads,
+           all * 1e9 / TRACE_EVENTS, (double)threads * TRACE_EVENTS / all / 1e6);
+    printf("dump: %zu events, %zu rings of %zu\n", dumped[1], dumped[1] / ring, ring);
+    if (dumped[0] % ring != 0 || dumped[0] < (size_t)threads * ring) {
+        fprintf(stderr, "dump holds %zu events, expected whole rings for %d threads\n", dumped[0], threads);
+        return 1;
+    }
+    if (dumped[1] != dumped[0]) {
+        fprintf(stderr, "second round added rings (%zu -> %zu events)\n", dumped[0], dumped[1]);
+        return 1;
+    }
+    return 0;
+}
+
+/* ── Board metrics (Tahta ölçüleri) ──────────────────────────────────── */
+/* 3BV, openings and islands by flooding cell by cell, as sim.c used to
+   (hücre hücre doldurarak başvuru ölçüleri) */
+static void ref_grade(const Board *b, uint8_t *seen, int *stack, uint32_t v[GRADE_COUNT]) {
+    const int R = b->rows, C = b->cols;
+    memset(v, 0, GRADE_COUNT * sizeof *v);
+    memset(seen, 0, (size_t)R * C);
+    for (int pass = 0; pass < 2; pass++)
+        for (int r = 0; r < R; r++)
+            for (int c = 0; c < C; c++) {
+                /* pass 0 floods zeros and marks their edge; pass 1 floods what is left
+                   (0. geçiş sıfırları, 1. geçiş kalan güvenli hücreleri doldurur) */
+                if (seen[r * C + c] || board_mine(b, r, c) || (pass == 0 && board_neigh(b, r, c) != 0)) continue;
+                v[pass == 0 ? GRADE_OPENINGS : GRADE_ISLANDS]++;
+                int top = 0;
+                seen[r * C + c] = 1;
+                stack[top++] = r * C + c;
+                while (top) {
+                    int i = stack[--top], ir = i / C, ic = i % C;
+                    v[GRADE_ISOLATED] += pass;
+                    for (int dr = -1; dr <= 1; dr++)
+                        for (int dc = -1; dc <= 1; dc++) {
+                            int nr = ir + dr, nc = ic + dc;
+                            if (nr < 0 || nr >= R || nc < 0 || nc >= C || seen[nr * C + nc] || board_mine(b, nr, nc)) continue;
+                            if (pass == 0) {
+                                seen[nr * C + nc] = 1;
+                                if (board_neigh(b, nr, nc) == 0) stack[top++] = nr * C + nc;
+                            } else {
+                                seen[nr * C + nc] = 1;
+                                stack[top++] = nr * C + nc;
+                            }
+                        }
+                }
+            }
+    v[GRADE_3BV] = v[GRADE_OPENINGS] + v[GRADE_ISOLATED];
+}
+
+static int grade_check(void) {
+    static const int density[] = {1, 5, 12, 16, 20, 30, 50};
+    Board b = {0};
+    Grader g = {0};
+    size_t n = 300 * 500;
+    uint8_t *seen = malloc(n);
+    int *stack = malloc(n * sizeof *stack);
+    int bad = 0, boards = 0;
+    if (!seen || !stack) { fprintf(stderr, "out of memory\n"); return 1; }
+
+    /* One mine in a 3×3 box: open an edge cell, flag, chord twice
+       (3×3 içinde bir mayın: aç, işaretle, iki akor) */
+    board_setup(&b, 3, 3, 1);
+    board_touch(&b, 1, 1)->cell[chunk_index(1, 1)] |= CELL_MINE;
+    board_compute_neighbors(&b);
+    Grade gr;
+    if (!grade_board(&g, &b, GRADE_WANT_ALL, &gr) || gr.value[GRADE_3BV] != 8 || gr.value[GRADE_ISLANDS] != 1
+        || gr.value[GRADE_ZINI] != 5) {
+        fprintf(stderr, "3x3: 3BV %u islands %u ZiNi %u, expected 8 1 5\n",
+                gr.value[GRADE_3BV], gr.value[GRADE_ISLANDS], gr.value[GRADE_ZINI]);
+        bad++;
+    }
+
+    for (int s = 0; s < 2000 && bad < 5; s++, boards++) {
+        int rows = 1 + s % 37 * 3, cols = 1 + s % 53 * 9, area = rows * cols;
+        if (s % 100 == 0) { rows = 300; cols = 500; area = rows * cols; }
+        int mines = (int)((int64_t)area * density[s % 7] / 100);
+        deal(&b, rows, cols, mines, (uint64_t)s + 1);
+        uint32_t want[GRADE_COUNT];
+        ref_grade(&b, seen, stack, want);
+        if (!grade_board(&g, &b, GRADE_WANT_ALL, &gr)) { fprintf(stderr, "out of memory\n"); return 1; }
+        const uint32_t *v = gr.value;
+        bool ok = v[GRADE_ZINI] >= v[GRADE_OPENINGS] && v[GRADE_ZINI] <= v[GRADE_3BV]
+               && v[GRADE_ISLANDS] <= v[GRADE_ISOLATED] && (v[GRADE_ISLANDS] == 0) == (v[GRADE_ISOLATED] == 0);
+        for (int m = 0; m < GRADE_COUNT; m++) ok = ok && (m == GRADE_ZINI || v[m] == want[m]);
+        if (!ok) {
+            fprintf(stderr, "%dx%d %d mines seed %d:", rows, cols, mines, s + 1);
+            for (int m = 0; m < GRADE_COUNT; m++)
+                fprintf(stderr, " %s %u/%u", grade_names[m], v[m], m == GRADE_ZINI ? v[m] : want[m]);
+            fprintf(stderr, "\n");
+            bad++;
+        }
+    }
+    printf("exactness: %d boards against flood fill, %s\n", boards, bad ? "FAILED" : "ok");
+    free(seen);
+    free(stack);
+    grade_free(&g);
+    board_free(&b);
+    return bad ? 1 : 0;
+}
+
+/* Histograms as CSV on stdout: metric,value,boards; the last bin also
+   holds every larger value (histogramlar CSV olarak) */
+static void grade_csv(const GradeResult *res, unsigned want) {
+    printf("metric,value,boards\n");
+    for (int m = 0; m < GRADE_COUNT; m++) {
+        if ((m == GRADE_ISLANDS && !(want & GRADE_WANT_ISLANDS)) || (m == GRADE_ZINI && !(want & GRADE_WANT_ZINI)))
+            continue;
+        for (int k = 0; k < GRADE_BINS; k++)
+            if (res->hist[m][k]) printf("%s,%d,%llu\n", grade_names[m], k, (unsigned long long)res->hist[m][k]);
+    }
+}
+
+static int bench_grade(int argc, char **argv) {
+    static GradeResult res, one;
+    if (argc >= 3) {
+        /* Batch: rows cols mines [boards] [threads] [seed] (toplu derecelendirme) */
+        GradeConfig cfg = {atoi(argv[0]), atoi(argv[1]), atoi(argv[2]),
+                           argc > 3 ? strtoull(argv[3], NULL, 10) : 1000000, argc > 5 ? strtoull(argv[5], NULL, 0) : 1,
+                           argc > 4 ? atoi(argv[4]) : 0, GRADE_WANT_ALL};
+        double t0 = now_sec();
+        if (!grade_run(&cfg, &res)) { fprintf(stderr, "bad arguments or out of memory\n"); return 1; }
+        double t = now_sec() - t0;
+        grade_csv(&res, cfg.want);
+        fprintf(stderr, "%llu boards of %dx%d with %d mines on %d threads: %.0f boards/min\n",
+                (unsigned long long)res.boards, cfg.rows, cfg.cols, cfg.mines, res.threads, res.boards / t * 60);
+        for (int m = 0; m < GRADE_COUNT; m++)
+            fprintf(stderr, "  %-9s mean %8.2f  min %6u  max %6u\n", grade_names[m],
+                    (double)res.sum[m] / res.boards, res.min[m], res.max[m]);
+        return 0;
+    }
+
+    if (grade_check()) return 1;
+    static const struct { const char *name; int rows, cols, mines; } config[] = {
+        {"beginner",     9,  9,  10},
+        {"intermediate", 16, 16, 40},
+        {"expert",       16, 30, 99},
+        {"30x30 20%",    30, 30, 180},
+    };
+    const uint64_t boards = 200000;
+    printf("%-13s %8s %8s %9s %8s %8s %8s %14s %14s\n", "config", "threads", "3BV", "openings", "isolated",
+           "islands", "ZiNi", "boards/min", "3BV only/min");
+    for (size_t i = 0; i < sizeof config / sizeof *config; i++) {
+        GradeConfig cfg = {config[i].rows, config[i].cols, config[i].mines, boards, 1, 0, GRADE_WANT_ALL};
+        double t0 = now_sec();
+        if (!grade_run(&cfg, &res)) { fprintf(stderr, "%s: out of memory\n", config[i].name); return 1; }
+        double t = now_sec() - t0;
+        GradeConfig basic = cfg;
+        basic.want = 0;
+        t0 = now_sec();
+        if (!grade_run(&basic, &one)) { fprintf(stderr, "%s: out of memory\n", config[i].name); return 1; }
+        double tb = now_sec() - t0;
+        double mean[GRADE_COUNT];
+        for (int m = 0; m < GRADE_COUNT; m++) mean[m] = (double)res.sum[m] / res.boards;
+        printf("%-13s %8d %8.2f %9.2f %8.2f %8.2f %8.2f %14.0f %14.0f\n", config[i].name, res.threads,
+               mean[GRADE_3BV], mean[GRADE_OPENINGS], mean[GRADE_ISOLATED], mean[GRADE_ISLANDS], mean[GRADE_ZINI],
+               boards / t * 60, boards / tb * 60);
+
+        /* Histograms must not depend on the thread count (histogram iş parçacığı sayısından bağımsız) */
+        cfg.boards  = 5000;
+        cfg.threads = 1;
+        GradeConfig many = cfg;
+        many.threads = 0;
+        if (!grade_run(&cfg, &one) || !grade_run(&many, &res) || memcmp(one.hist, res.hist, sizeof one.hist) != 0) {
+            fprintf(stderr, "%s: thread count changed the histograms\n", config[i].name);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    const char *what = argc > 1 ? argv[1] : "reveal";
+    if (strcmp(what, "reveal") == 0) return bench_reveal();
+    if (strcmp(what, "huge")   == 0) return bench_huge();
+    if (strcmp(what, "neighbors") == 0) return bench_neighbors();
+    if (strcmp(what, "place")  == 0) return bench_place();
+    if (strcmp(what, "noguess") == 0) return bench_noguess(argc > 2 ? atoi(argv[2]) : 0);
+    if (strcmp(what, "solver") == 0) return bench_solver();
+    if (strcmp(what, "prob")   == 0) return bench_prob();
+    if (strcmp(what, "sim")    == 0)
+        return bench_sim(argc > 2 ? argv[2] : "solver", argc > 3 ? strtoull(argv[3], NULL, 10) : 1000000,
+                         argc > 4 ? atoi(argv[4]) : 0);
+    if (strcmp(what, "suite")  == 0) return bench_suite(argc > 2 ? atoi(argv[2]) : 0);
+    if (strcmp(what, "replay") == 0) return bench_replay(argc - 2, argv + 2);
+    if (strcmp(what, "snapshot") == 0) return bench_snapshot();
+    if (strcmp(what, "undo")   == 0) return bench_undo();
+    if (strcmp(what, "presets") == 0) return bench_presets();
+    if (strcmp(what, "trace")  == 0) return bench_trace(argc > 2 ? argv[2] : NULL);
+    if (strcmp(what, "flood")  == 0) return bench_flood(argc > 2 ? atoi(argv[2]) : 0);
+    if (strcmp(what, "openings") == 0) return bench_openings();
+    if (strcmp(what, "pool")   == 0) return bench_pool();
+    if (strcmp(what, "grade")  == 0) return bench_grade(argc - 2, argv + 2);
+    fprintf(stderr, "usage: %s [reveal|huge|neighbors|place|noguess [threads]|solver|prob|"
+                    "sim [strategy] [games] [threads]|suite [samples]|replay [file.mrp …]|snapshot|undo|presets|trace [out.json]|flood [threads]|openings|pool|\n"
+                    "grade [rows cols mines [boards] [threads] [seed] > hist.csv]]\n", argv[0]);
+    return 2;
+}
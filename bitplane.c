@@ -0,0 +1,201 @@
+#include "bitplane.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define PLANE_X86 1
+#endif
+
+/* ── Allocation (Bellek ayırma) ──────────────────────────────────────── */
+static size_t plane_words(const BitPlane *p) {
+    return 1 + (size_t)(p->rows + 2) * (p->stride + 1);
+}
+
+bool plane_setup(BitPlane *p, int rows, int cols) {
+    p->rows   = rows;
+    p->cols   = cols;
+    p->stride = ((size_t)cols + 63) / 64;
+    p->bits   = calloc(plane_words(p), sizeof *p->bits);
+    return p->bits != NULL;
+}
+
+void plane_free(BitPlane *p) {
+    free(p->bits);
+    memset(p, 0, sizeof *p);
+}
+
+void plane_clear(BitPlane *p) {
+    memset(p->bits, 0, plane_words(p) * sizeof *p->bits);
+}
+
+size_t plane_count(const BitPlane *p) {
+    size_t n = 0;
+    for (int r = 0; r < p->rows; r++) {
+        const uint64_t *row = plane_row(p, r);
+        for (size_t w = 0; w < p->stride; w++) n += (size_t)__builtin_popcountll(row[w]);
+    }
+    return n;
+}
+
+/* Valid bits of the last word in a row (satırın son sözcüğündeki geçerli bitler) */
+static uint64_t tail_mask(const BitPlane *p) {
+    return (p->cols & 63) ? (1ull << (p->cols & 63)) - 1 : ~0ull;
+}
+
+/* ── Kernel dispatch (Çekirdek seçimi) ───────────────────────────────── */
+PlaneKernel plane_kernel_resolve(PlaneKernel k) {
+#ifdef PLANE_X86
+    static int avx2 = -1;
+    if (avx2 < 0) { __builtin_cpu_init(); avx2 = __builtin_cpu_supports("avx2") ? 1 : 0; }
+    if (k == PLANE_AUTO) return avx2 ? PLANE_AVX2 : PLANE_SSE2;
+    if (k == PLANE_AVX2 && !avx2) return PLANE_SSE2;
+    return k;
+#else
+    (void)k;
+    return PLANE_SCALAR;
+#endif
+}
+
+const char *plane_kernel_name(PlaneKernel k) {
+    switch (k) {
+    case PLANE_SCALAR: return "scalar";
+    case PLANE_SSE2:   return "sse2";
+    case PLANE_AVX2:   return "avx2";
+    default:           return "auto";
+    }
+}
+
+/*
+ * The kernels are written once as macros over a lane type T holding W
+ * 64-bit words, then instantiated for uint64_t, SSE2 and AVX2. WEST(p)
+ * moves every cell's left neighbor onto it, EAST(p) its right neighbor;
+ * the word before and after each row is a zero guard.
+ *
+ * Eight neighbor bits are summed with carry-save adders (CSA): three
+ * one-bit inputs become a sum bit and a carry bit, so 8 inputs reduce to
+ * 1s, 2s, 4s and 8s planes in 7 CSAs/half-adders.
+ *
+ * (Çekirdekler bir kez makro olarak yazılır, sonra skaler/SSE2/AVX2 için
+ *  örneklenir. Sekiz komşu biti elde-saklamalı toplayıcılarla toplanır.)
+ */
+#define CSA(T, X, A, O, hi, lo, a, b, c) \
+    do { T u_ = X(a, b); hi = O(A(a, b), A(u_, c)); lo = X(u_, c); } while (0)
+
+#define DEFINE_KERNELS(suffix, ATTR, T, W, LD, ST, A, O, X, SHL, SHR)                     \
+ATTR static size_t count_row_##suffix(const uint64_t *up, const uint64_t *mid,            \
+                                      const uint64_t *dn, size_t n, uint64_t **out) {     \
+    size_t w = 0;                                                                         \
+    for (; w + W <= n; w += W) {                                                          \
+        T u = LD(up + w), m = LD(mid + w), d = LD(dn + w);                                \
+        T uw = O(SHL(u, 1), SHR(LD(up  + w - 1), 63)), ue = O(SHR(u, 1), SHL(LD(up  + w + 1), 63)); \
+        T mw = O(SHL(m, 1), SHR(LD(mid + w - 1), 63)), me = O(SHR(m, 1), SHL(LD(mid + w + 1), 63)); \
+        T dw = O(SHL(d, 1), SHR(LD(dn  + w - 1), 63)), de = O(SHR(d, 1), SHL(LD(dn  + w + 1), 63)); \
+        T c1, s1, c2, s2, c3, ones, twos, d1, d2;                                         \
+        CSA(T, X, A, O, c1, s1, uw, u, ue);                                               \
+        CSA(T, X, A, O, c2, s2, mw, me, dw);                                              \
+        CSA(T, X, A, O, c3, s1, s1, s2, d);                                               \
+        T c4 = A(s1, de);                                                                 \
+        ones = X(s1, de);                                                                 \
+        CSA(T, X, A, O, d1, twos, c1, c2, c3);                                            \
+        d2   = A(twos, c4);                                                               \
+        twos = X(twos, c4);                                                               \
+        ST(out[0] + w, ones);                                                             \
+        ST(out[1] + w, twos);                                                             \
+        ST(out[2] + w, X(d1, d2));                                                        \
+        ST(out[3] + w, A(d1, d2));                                                        \
+    }                                                                                     \
+    return w;                                                                             \
+}                                                                                         \
+ATTR static size_t dilate_row_##suffix(const uint64_t *up, const uint64_t *mid,           \
+                                       const uint64_t *dn, size_t n, uint64_t *dst) {     \
+    size_t w = 0;                                                                         \
+    for (; w + W <= n; w += W) {                                                          \
+        T v  = O(O(LD(up + w), LD(mid + w)), LD(dn + w));                                 \
+        T vl = O(O(LD(up + w - 1), LD(mid + w - 1)), LD(dn + w - 1));                     \
+        T vr = O(O(LD(up + w + 1), LD(mid + w + 1)), LD(dn + w + 1));                     \
+        T h  = O(v, O(O(SHL(v, 1), SHR(vl, 63)), O(SHR(v, 1), SHL(vr, 63))));              \
+        ST(dst + w, h);                                                                   \
+    }                                                                                     \
+    return w;                                                                             \
+}
+
+#define S_LD(p)     (*(p))
+#define S_ST(p, v)  (*(p) = (v))
+#define S_AND(a, b) ((a) & (b))
+#define S_OR(a, b)  ((a) | (b))
+#define S_XOR(a, b) ((a) ^ (b))
+#define S_SHL(a, n) ((a) << (n))
+#define S_SHR(a, n) ((a) >> (n))
+DEFINE_KERNELS(scalar, , uint64_t, 1, S_LD, S_ST, S_AND, S_OR, S_XOR, S_SHL, S_SHR)
+
+#ifdef PLANE_X86
+#define X128_LD(p)     _mm_loadu_si128((const __m128i *)(const void *)(p))
+#define X128_ST(p, v)  _mm_storeu_si128((__m128i *)(void *)(p), (v))
+DEFINE_KERNELS(sse2, __attribute__((target("sse2"))), __m128i, 2, X128_LD, X128_ST,
+               _mm_and_si128, _mm_or_si128, _mm_xor_si128, _mm_slli_epi64, _mm_srli_epi64)
+
+#define X256_LD(p)     _mm256_loadu_si256((const __m256i *)(const void *)(p))
+#define X256_ST(p, v)  _mm256_storeu_si256((__m256i *)(void *)(p), (v))
+DEFINE_KERNELS(avx2, __attribute__((target("avx2"))), __m256i, 4, X256_LD, X256_ST,
+               _mm256_and_si256, _mm256_or_si256, _mm256_xor_si256, _mm256_slli_epi64, _mm256_srli_epi64)
+#endif
+
+void plane_count_row(const BitPlane *p, int r, uint64_t *out[4], PlaneKernel k) {
+    const uint64_t *up = plane_row(p, r - 1), *mid = plane_row(p, r), *dn = plane_row(p, r + 1);
+    size_t n = p->stride, done = 0;
+    switch (plane_kernel_resolve(k)) {
+#ifdef PLANE_X86
+    case PLANE_AVX2: done = count_row_avx2(up, mid, dn, n, out); break;
+    case PLANE_SSE2: done = count_row_sse2(up, mid, dn, n, out); break;
+#endif
+    default: break;
+    }
+    /* Tail words the vector loop could not fill (vektör döngüsünden kalanlar) */
+    if (done < n) {
+        uint64_t *rest[4] = {out[0] + done, out[1] + done, out[2] + done, out[3] + done};
+        count_row_scalar(up + done, mid + done, dn + done, n - done, rest);
+    }
+}
+
+static void dilate_row(const BitPlane *src, int r, uint64_t *dst, PlaneKernel k) {
+    const uint64_t *up = plane_row(src, r - 1), *mid = plane_row(src, r), *dn = plane_row(src, r + 1);
+    size_t n = src->stride, done = 0;
+    switch (k) {
+#ifdef PLANE_X86
+    case PLANE_AVX2: done = dilate_row_avx2(up, mid, dn, n, dst); break;
+    case PLANE_SSE2: done = dilate_row_sse2(up, mid, dn, n, dst); break;
+#endif
+    default: break;
+    }
+    if (done < n) dilate_row_scalar(up + done, mid + done, dn + done, n - done, dst + done);
+    dst[n - 1] &= tail_mask(src);
+}
+
+void plane_dilate(const BitPlane *src, BitPlane *dst, PlaneKernel k) {
+    k = plane_kernel_resolve(k);
+    for (int r = 0; r < src->rows; r++) dilate_row(src, r, plane_row(dst, r), k);
+}
+
+int plane_grow_opening(BitPlane *region, const BitPlane *zeros, BitPlane *scratch, PlaneKernel k) {
+    k = plane_kernel_resolve(k);
+    int passes = 0;
+    for (bool grew = true; grew; passes++) {
+        grew = false;
+        for (int r = 0; r < region->rows; r++) {
+            uint64_t *d = plane_row(scratch, r);
+            const uint64_t *s = plane_row(region, r), *z = plane_row(zeros, r);
+            dilate_row(region, r, d, k);
+            for (size_t w = 0; w < region->stride; w++) {
+                d[w] = (d[w] & z[w]) | s[w];
+                grew |= d[w] != s[w];
+            }
+        }
+        uint64_t *t = region->bits; region->bits = scratch->bits; scratch->bits = t;
+    }
+    /* Numbered border around the zeros (sıfırların çevresindeki sayılı kenar) */
+    plane_dilate(region, scratch, k);
+    uint64_t *t = region->bits; region->bits = scratch->bits; scratch->bits = t;
+    return passes;
+}
@@ -0,0 +1,80 @@
+/*
+ * bitplane.h — one-bit-per-cell board views and bit-parallel kernels
+ * (hücre başına bir bitlik tahta görünümleri ve bit-paralel çekirdekler)
+ *
+ * A BitPlane is row-major, each row padded to whole 64-bit words, with a
+ * zero guard word between rows and an all-zero row above the first and
+ * below the last. Kernels can therefore read one word left/right and one
+ * row up/down of any cell without bounds checks. Bits past `cols` in the
+ * last word of a row are kept zero.
+ *
+ * (Satır öncelikli; satırlar 64 bitlik sözcüklere tamamlanır, satırlar
+ *  arasında sıfır koruma sözcüğü, ilk satırın üstünde ve son satırın
+ *  altında sıfır satır vardır — çekirdekler sınır denetimi yapmaz.)
+ */
+#ifndef BITPLANE_H
+#define BITPLANE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct BitPlane {
+    int       rows, cols;
+    size_t    stride;                          /* data words per row (satır başına sözcük) */
+    uint64_t *bits;
+} BitPlane;
+
+bool   plane_setup(BitPlane *p, int rows, int cols);   /* zeroed; false on OOM */
+void   plane_free(BitPlane *p);
+void   plane_clear(BitPlane *p);
+size_t plane_count(const BitPlane *p);
+
+/* Row r, valid for -1 … rows (the outer two are all-zero) (satır r) */
+static inline uint64_t *plane_row(const BitPlane *p, int r) {
+    return p->bits + 1 + (size_t)(r + 1) * (p->stride + 1);
+}
+
+static inline bool plane_get(const BitPlane *p, int r, int c) {
+    return (plane_row(p, r)[c >> 6] >> (c & 63)) & 1;
+}
+
+static inline void plane_set(BitPlane *p, int r, int c) {
+    plane_row(p, r)[c >> 6] |= 1ull << (c & 63);
+}
+
+/* ── Kernels (Çekirdekler) ───────────────────────────────────────────── */
+typedef enum {
+    PLANE_AUTO,                                /* best the CPU supports (işlemcinin en iyisi) */
+    PLANE_SCALAR,                              /* 64 cells per step, plain uint64_t */
+    PLANE_SSE2,                                /* 128 cells per step */
+    PLANE_AVX2,                                /* 256 cells per step */
+} PlaneKernel;
+
+PlaneKernel plane_kernel_resolve(PlaneKernel k);   /* AUTO/unsupported → what will run */
+const char *plane_kernel_name(PlaneKernel k);
+
+/*
+ * Neighbor counts for row r of a mine plane, bit-sliced: bit c of out[k]
+ * is bit k of the number of mines around (r, c), 0…8. Each out[k] must
+ * hold p->stride words. Built from shifted copies of rows r-1, r, r+1
+ * summed with a carry-save adder tree — no per-cell branches.
+ * (r satırı için bit dilimli komşu sayıları: out[k]'nın c biti, (r, c)
+ *  çevresindeki mayın sayısının k bitidir.)
+ */
+void plane_count_row(const BitPlane *mines, int r, uint64_t *out[4], PlaneKernel k);
+
+/* dst = src grown by one cell in all eight directions; dst != src
+   (src'yi sekiz yönde bir hücre büyüt) */
+void plane_dilate(const BitPlane *src, BitPlane *dst, PlaneKernel k);
+
+/*
+ * Grow a revealed region through zero cells: repeatedly dilate `region`
+ * and keep what lands on `zeros`, until nothing changes; then add one more
+ * ring (the numbered border an opening always shows). `scratch` must
+ * have the same shape. Returns the number of dilation passes.
+ * (Açık bölgeyi sıfır hücreler üzerinden büyütür, sonra sayılı kenarı ekler.)
+ */
+int  plane_grow_opening(BitPlane *region, const BitPlane *zeros, BitPlane *scratch, PlaneKernel k);
+
+#endif
@@ -0,0 +1,529 @@
+#include "board.h"
+#include "rng.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+typedef struct BoardKernels {
+    int  rows, cols;
+    void (*neighbors)(Board *b);
+    int  (*reveal)(Board *b, int r, int c, ChangeSet *out);
+} BoardKernels;
+
+static const BoardKernels *preset_kernels(int rows, int cols);
+
+/* ── Allocation (Bellek ayırma) ──────────────────────────────────────── */
+static size_t chunk_total(const Board *b) {
+    return (size_t)b->chunk_rows * b->chunk_cols;
+}
+
+static void drop_chunks(Board *b) {
+    if (!b->chunks) return;
+    for (size_t i = 0, n = chunk_total(b); i < n; i++) { free(b->chunks[i]); b->chunks[i] = NULL; }
+    b->chunks_live = 0;
+}
+
+void board_free(Board *b) {
+    drop_chunks(b);
+    free(b->chunks);
+    free(b->stack);
+    memset(b, 0, sizeof *b);
+}
+
+bool board_setup(Board *b, int rows, int cols, int mines) {
+    if (rows < 1 || cols < 1 || mines < 0) return false;
+    if ((long long)rows * cols > INT_MAX || mines > rows * cols) return false;
+
+    if (b->rows != rows || b->cols != cols || !b->chunks) {
+        board_free(b);
+        b->chunk_rows = (rows + CHUNK_DIM - 1) >> CHUNK_BITS;
+        b->chunk_cols = (cols + CHUNK_DIM - 1) >> CHUNK_BITS;
+        b->chunks     = calloc(chunk_total(b), sizeof *b->chunks);
+        if (!b->chunks) { board_free(b); return false; }
+        b->rows = rows;
+        b->cols = cols;
+    } else {
+        drop_chunks(b);
+    }
+    b->mines          = mines;
+    b->revealed_count = 0;
+    b->exploded       = false;
+    b->kern           = preset_kernels(rows, cols);
+    return true;
+}
+
+Chunk *board_touch(Board *b, int r, int c) {
+    Chunk **slot = &b->chunks[(size_t)(r >> CHUNK_BITS) * b->chunk_cols + (c >> CHUNK_BITS)];
+    if (!*slot && (*slot = calloc(1, sizeof **slot)) != NULL) b->chunks_live++;
+    return *slot;
+}
+
+/* ── Mine placement & neighbor count (Mayın yerleştirme ve komşu sayısı) */
+/* Inside the 3×3 kept clear around (sr, sc) (korunan 3×3 alanın içinde mi) */
+static inline bool in_zone(int r, int c, int sr, int sc) {
+    return sr >= 0 && r >= sr - 1 && r <= sr + 1 && c >= sc - 1 && c <= sc + 1;
+}
+
+void board_place_mines_around(Board *b, int sr, int sc) {
+    size_t n = (size_t)b->rows * b->cols;
+    size_t zone = 0;
+    if (sr >= 0)
+        for (int r = sr - 1; r <= sr + 1; r++)
+            for (int c = sc - 1; c <= sc + 1; c++)
+                zone += r >= 0 && r < b->rows && c >= 0 && c < b->cols;
+    if ((size_t)b->mines > n - zone) sr = sc = -1, zone = 0;   /* too full to keep it clear (yer yok) */
+
+    size_t avail = n - zone;
+    bool dense = (size_t)b->mines * 2 > avail;
+    size_t draws = dense ? avail - (size_t)b->mines : (size_t)b->mines;
+
+    for (size_t i = 0, nc = chunk_total(b); i < nc; i++)
+        if (b->chunks[i])
+            for (int j = 0; j < CHUNK_CELLS; j++) b->chunks[i]->cell[j] &= (uint8_t)~CELL_MINE;
+    /* Dense: fill chunk by chunk — whole chunks byte by byte — then clear
+       the zone (yoğun: parça parça doldur, sonra alanı boşalt) */
+    if (dense) {
+        for (size_t i = 0, nc = chunk_total(b); i < nc; i++) {
+            int r0 = (int)(i / b->chunk_cols) << CHUNK_BITS, c0 = (int)(i % b->chunk_cols) << CHUNK_BITS;
+            int h = b->rows - r0 < CHUNK_DIM ? b->rows - r0 : CHUNK_DIM;
+            int w = b->cols - c0 < CHUNK_DIM ? b->cols - c0 : CHUNK_DIM;
+            Chunk *k = board_touch(b, r0, c0);
+            if (!k) return;
+            if (h == CHUNK_DIM && w == CHUNK_DIM)
+                for (int j = 0; j < CHUNK_CELLS; j++) k->cell[j] |= CELL_MINE;
+            else
+                for (int lr = 0; lr < h; lr++)
+                    for (int lc = 0; lc < w; lc++) k->cell[chunk_index(lr, lc)] |= CELL_MINE;
+        }
+        for (int r = sr - 1; sr >= 0 && r <= sr + 1; r++)
+            for (int c = sc - 1; c <= sc + 1; c++)
+                if (r >= 0 && r < b->rows && c >= 0 && c < b->cols)
+                    board_chunk(b, r, c)->cell[chunk_index(r, c)] &= (uint8_t)~CELL_MINE;
+    }
+
+    /* Draw distinct cells and flip their mine bit (farklı hücreler çek ve çevir) */
+    Rng g = rng_init(b->seed);
+    while (draws) {
+        size_t i = (size_t)rng_below(&g, n);
+        int r = (int)(i / b->cols), c = (int)(i % b->cols);
+        if (board_mine(b, r, c) == dense && !in_zone(r, c, sr, sc)) {
+            Chunk *k = board_touch(b, r, c);
+            if (!k) return;
+            k->cell[chunk_index(r, c)] ^= CELL_MINE;
+            draws--;
+        }
+    }
+}
+
+void board_place_mines(Board *b) {
+    board_place_mines_around(b, -1, -1);
+}
+
+/* Fallback when the mine plane cannot be allocated: each mine bumps its
+   eight neighbors (düzlem ayrılamazsa: her mayın komşularını artırır) */
+static void scatter_neighbors(Board *b) {
+    size_t n = chunk_total(b);
+    for (size_t i = 0; i < n; i++) {
+        Chunk *k = b->chunks[i];
+        if (!k) continue;
+        int r0 = (int)(i / b->chunk_cols) << CHUNK_BITS;
+        int c0 = (int)(i % b->chunk_cols) << CHUNK_BITS;
+        for (int lr = 0; lr < CHUNK_DIM && r0 + lr < b->rows; lr++)
+            for (int lc = 0; lc < CHUNK_DIM && c0 + lc < b->cols; lc++) {
+                if (!(k->cell[chunk_index(lr, lc)] & CELL_MINE)) continue;
+                int r = r0 + lr, c = c0 + lc;
+                for (int dr = -1; dr <= 1; dr++)
+                    for (int dc = -1; dc <= 1; dc++) {
+                        int rr = r+dr, cc = c+dc;
+                        if (rr < 0 || rr >= b->rows || cc < 0 || cc >= b->cols) continue;
+                        if (board_mine(b, rr, cc)) continue;
+                        Chunk *nk = board_touch(b, rr, cc);
+                        if (nk) nk->cell[chunk_index(rr, cc)]++;      /* count is the low nibble (sayı alt yarım bayt) */
+                    }
+            }
+    }
+}
+
+/*
+ * Mines are gathered into a bit plane and each row's counts come out of
+ * the bit-parallel kernel (bitplane.c) as four bit-sliced words per 64
+ * cells. Only non-zero counts are written back, so chunks far from any
+ * mine stay unallocated.
+ * (Mayınlar bit düzlemine toplanır, her satırın sayıları bit-paralel
+ *  çekirdekten gelir; yalnızca sıfır olmayan sayılar yazılır.)
+ */
+void board_compute_neighbors(Board *b) {
+    if (b->kern) { b->kern->neighbors(b); return; }
+    size_t n = chunk_total(b);
+    for (size_t i = 0; i < n; i++) {
+        Chunk *k = b->chunks[i];
+        if (!k) continue;
+        for (int j = 0; j < CHUNK_CELLS; j++) k->cell[j] &= (uint8_t)~CELL_COUNT;
+    }
+
+    BitPlane mp = {0};
+    uint64_t *sl = NULL;
+    if (!plane_setup(&mp, b->rows, b->cols) || !(sl = malloc(4 * mp.stride * sizeof *sl))) {
+        plane_free(&mp);
+        scatter_neighbors(b);
+        return;
+    }
+    board_extract_plane(b, CELL_MINE, CELL_MINE, &mp);
+
+    /* A 64-bit word of a row is exactly one chunk column wide (bir sözcük = bir parça sütunu) */
+    uint64_t *out[4] = {sl, sl + mp.stride, sl + 2 * mp.stride, sl + 3 * mp.stride};
+    for (int r = 0; r < b->rows; r++) {
+        plane_count_row(&mp, r, out, PLANE_AUTO);
+        const uint64_t *m = plane_row(&mp, r);
+        unsigned rz = zorder_spread((unsigned)r) << 1;
+        for (size_t w = 0; w < mp.stride; w++) {
+            uint64_t b0 = out[0][w], b1 = out[1][w], b2 = out[2][w], b3 = out[3][w];
+            uint64_t nz = (b0 | b1 | b2 | b3) & ~m[w];
+            if (!nz) continue;
+            Chunk *k = board_touch(b, r, (int)(w * 64));
+            if (!k) continue;
+            do {
+                int bit = __builtin_ctzll(nz);
+                unsigned cnt = (unsigned)((b0 >> bit) & 1)
+                             | (unsigned)((b1 >> bit) & 1) << 1
+                             | (unsigned)((b2 >> bit) & 1) << 2
+                             | (unsigned)((b3 >> bit) & 1) << 3;
+                k->cell[rz | zorder_spread((unsigned)bit)] |= (uint8_t)cnt;
+                nz &= nz - 1;
+            } while (nz);
+        }
+    }
+    free(sl);
+    plane_free(&mp);
+}
+
+/* ── Change sets (Değişiklik kümeleri) ───────────────────────────────── */
+void changes_clear(ChangeSet *cs) {
+    cs->n   = 0;
+    cs->oom = false;
+}
+
+void changes_free(ChangeSet *cs) {
+    free(cs->cells);
+    memset(cs, 0, sizeof *cs);
+}
+
+void changes_add(ChangeSet *cs, int r, int c, uint8_t cell) {
+    if (cs->n == cs->cap) {
+        size_t cap = cs->cap ? cs->cap * 2 : 64;
+        CellChange *p = realloc(cs->cells, cap * sizeof *p);
+        if (!p) { cs->oom = true; return; }
+        cs->cells = p; cs->cap = cap;
+    }
+    if (cs->n == 0) {
+        cs->r0 = cs->r1 = r;
+        cs->c0 = cs->c1 = c;
+    } else {
+        if (r < cs->r0) cs->r0 = r;
+        if (r > cs->r1) cs->r1 = r;
+        if (c < cs->c0) cs->c0 = c;
+        if (c > cs->c1) cs->c1 = c;
+    }
+    cs->cells[cs->n++] = (CellChange){r, c, cell};
+}
+
+/* ── Flagging (Bayraklama) ───────────────────────────────────────────── */
+bool board_toggle_flag(Board *b, int r, int c, ChangeSet *out) {
+    if (board_revealed(b, r, c)) return false;
+    Chunk *k = board_touch(b, r, c);
+    if (!k) return false;
+    uint8_t *v = &k->cell[chunk_index(r, c)];
+    *v ^= CELL_FLAGGED;
+    if (out) changes_add(out, r, c, *v);
+    return true;
+}
+
+/* ── Reveal (Açma) ───────────────────────────────────────────────────── */
+/*
+ * The cell helpers take k0, the board's only chunk when the caller knows
+ * it fits in one (preset kernels), or NULL for the generic chunk lookup.
+ * (k0: tahta tek parçaya sığıyorsa o parça, yoksa NULL.)
+ */
+/* zorder_spread as a table, for the single-chunk path (tek parça yolu için tablo) */
+#define ZS2(n)  n, (n) + 1
+#define ZS4(n)  ZS2(n),  ZS2((n) + 4)
+#define ZS8(n)  ZS4(n),  ZS4((n) + 16)
+#define ZS16(n) ZS8(n),  ZS8((n) + 64)
+#define ZS32(n) ZS16(n), ZS16((n) + 256)
+static const uint16_t zspread[CHUNK_DIM] = { ZS32(0), ZS32(1024) };
+#undef ZS2
+#undef ZS4
+#undef ZS8
+#undef ZS16
+#undef ZS32
+
+static ALWAYS_INLINE unsigned index0(int r, int c) {
+    return (unsigned)zspread[c] | (unsigned)zspread[r] << 1;
+}
+
+static ALWAYS_INLINE uint8_t peek(const Board *b, const Chunk *k0, int r, int c) {
+    return k0 ? k0->cell[index0(r, c)] : board_cell(b, r, c);
+}
+
+static ALWAYS_INLINE bool open_cell(Board *b, Chunk *k0, int r, int c, ChangeSet *out) {
+    Chunk *k = k0 ? k0 : board_touch(b, r, c);
+    if (!k) return false;
+    uint8_t *v = &k->cell[k0 ? index0(r, c) : chunk_index(r, c)];
+    *v |= CELL_REVEALED;
+    b->revealed_count++;
+    if (out) changes_add(out, r, c, *v);
+    return true;
+}
+
+/* Hidden, unflagged (gizli ve bayraksız) */
+static ALWAYS_INLINE bool closed(const Board *b, const Chunk *k0, int r, int c) {
+    return !(peek(b, k0, r, c) & (CELL_REVEALED | CELL_FLAGGED));
+}
+
+/* A zero cell the flood may still spread through — one masked compare
+   (yayılabilir sıfır hücre — tek maskeli karşılaştırma) */
+static ALWAYS_INLINE bool fillable(const Board *b, const Chunk *k0, int r, int c) {
+    return !(peek(b, k0, r, c) & (CELL_COUNT | CELL_MINE | CELL_REVEALED | CELL_FLAGGED));
+}
+
+static bool push(Board *b, size_t *top, size_t i) {
+    if (*top == b->stack_cap) {
+        size_t cap = b->stack_cap ? b->stack_cap * 2 : 256;
+        size_t *s  = realloc(b->stack, cap * sizeof *s);
+        if (!s) return false;
+        b->stack = s; b->stack_cap = cap;
+    }
+    b->stack[(*top)++] = i;
+    return true;
+}
+
+/*
+ * Scanline flood fill. Each seed on the work-list is a zero cell; popping
+ * it opens the maximal horizontal run of zeros through it, then walks the
+ * rows above and below across the run (plus one diagonal cell each side):
+ * numbered cells there are opened directly, and each run of zeros is pushed
+ * as a single seed. Flagged cells block the flood, as before. Written once
+ * for any R × C and inlined into the generic and the preset entry points.
+ *
+ * (Tarama satırı doldurma: her tohum bir sıfır hücredir; satırdaki sıfır
+ *  dizisini açar, üst ve alt satırları tarar — sayılı hücreleri doğrudan
+ *  açar, her sıfır dizisi için tek tohum ekler. Bayraklar yayılmayı durdurur.)
+ */
+static ALWAYS_INLINE int reveal_impl(Board *b, Chunk *k0, const int R, const int C,
+                                     int r, int c, ChangeSet *out) {
+    if (r < 0 || r >= R || c < 0 || c >= C) return 0;
+    if (!closed(b, k0, r, c)) return 0;
+
+    int before = b->revealed_count;
+    if (!fillable(b, k0, r, c)) {
+        if (open_cell(b, k0, r, c, out) && (peek(b, k0, r, c) & CELL_MINE)) b->exploded = true;
+        return b->revealed_count - before;
+    }
+
+    size_t top = 0;
+    push(b, &top, (size_t)r * C + c);
+    while (top) {
+        size_t s = b->stack[--top];
+        int sr = (int)(s / C), sc = (int)(s % C);
+        if (!fillable(b, k0, sr, sc)) continue;     /* filled via another run (başka diziyle doldu) */
+
+        int x0 = sc, x1 = sc;
+        while (x0 > 0     && fillable(b, k0, sr, x0 - 1)) x0--;
+        while (x1 < C - 1 && fillable(b, k0, sr, x1 + 1)) x1++;
+        for (int x = x0; x <= x1; x++)
+            if (!open_cell(b, k0, sr, x, out)) return b->revealed_count - before;
+
+        int lo = x0 > 0 ? x0 - 1 : 0;
+        int hi = x1 < C - 1 ? x1 + 1 : C - 1;
+        /* Span ends on this row are numbers or blocked (satır uçları) */
+        if (lo < x0 && closed(b, k0, sr, lo)) open_cell(b, k0, sr, lo, out);
+        if (hi > x1 && closed(b, k0, sr, hi)) open_cell(b, k0, sr, hi, out);
+
+        for (int nr = sr - 1; nr <= sr + 1; nr += 2) {
+            if (nr < 0 || nr >= R) continue;
+            bool in_run = false;
+            for (int x = lo; x <= hi; x++) {
+                if (fillable(b, k0, nr, x)) {
+                    if (!in_run && !push(b, &top, (size_t)nr * C + x)) return b->revealed_count - before;
+                    in_run = true;
+                } else {
+                    in_run = false;
+                    if (closed(b, k0, nr, x)) open_cell(b, k0, nr, x, out);
+                }
+            }
+        }
+    }
+    return b->revealed_count - before;
+}
+
+int board_reveal(Board *b, int r, int c, ChangeSet *out) {
+    if (b->kern) return b->kern->reveal(b, r, c, out);
+    return reveal_impl(b, NULL, b->rows, b->cols, r, c, out);
+}
+
+/* ── Preset kernels (Hazır boyut çekirdekleri) ───────────────────────── */
+/*
+ * A preset board is a single chunk, so its mines fit one word per row.
+ * Inside the chunk, a 2 × 4 block at an even row and a column that is a
+ * multiple of four is eight consecutive bytes in Z-order:
+ *
+ *   byte  0 1 2 3 4 5 6 7
+ *   row   r r s s r r s s      (s = r + 1)
+ *   col   c . c . . . . .      c, c+1, c, c+1, c+2, c+3, c+2, c+3
+ *
+ * so the kernel moves a whole block per 64-bit load or store: the eight
+ * mine bits are packed into a byte with one multiply, and eight counts
+ * are spread back out to bytes with another. Rows of mines are stored
+ * shifted up by one bit with a zero row above and below, so a row's eight
+ * neighbor words are plain shifts with no edge tests; they are summed
+ * bit-sliced by full adders, as in bitplane.c. R and C are constants in
+ * each instance, so every bound is an immediate.
+ * (Hazır tahta tek parçadır. Z sırasında çift satır ve dördün katı sütunda
+ *  başlayan 2 × 4 blok ardışık sekiz bayttır; çekirdek blok başına bir
+ *  64 bitlik okuma/yazma yapar, mayın bitlerini tek çarpmayla toplar,
+ *  sayıları başka bir çarpmayla baytlara yayar.)
+ */
+#define FULL_ADD(s, cy, a, b, c) \
+    do { uint64_t t_ = (a) ^ (b); s = t_ ^ (c); cy = ((a) & (b)) | (t_ & (c)); } while (0)
+
+#define BYTE_LSB 0x0101010101010101ull
+
+/* Bit 0 of each byte into bit j of the result (her baytın 0. biti → j. bit) */
+static ALWAYS_INLINE unsigned pack8(uint64_t x) {
+    return (unsigned)(((x & BYTE_LSB) * 0x0102040810204080ull) >> 56);
+}
+
+/* Bit j of the index into bit 0 of byte j (indeksin j. biti → j. baytın 0. biti) */
+#define SPREAD2(n) n, (n) + 0x1ull, (n) + 0x100ull, (n) + 0x101ull
+#define SPREAD4(n) SPREAD2(n), SPREAD2((n) + 0x10000ull), SPREAD2((n) + 0x1000000ull), SPREAD2((n) + 0x1010000ull)
+#define SPREAD6(n) SPREAD4(n), SPREAD4((n) + 0x100000000ull), SPREAD4((n) + 0x10000000000ull), \
+                   SPREAD4((n) + 0x10100000000ull)
+static const uint64_t spread8[256] = {
+    SPREAD6(0), SPREAD6(0x1000000000000ull), SPREAD6(0x100000000000000ull), SPREAD6(0x101000000000000ull)
+};
+#undef SPREAD2
+#undef SPREAD4
+#undef SPREAD6
+
+/* Row 0 or 1 of a block's eight bits, as four bits (bloğun bir satırı) */
+static ALWAYS_INLINE unsigned unzip4(unsigned z, int row) {
+    z >>= 2 * row;
+    return (z & 3) | (z >> 2 & 0xC);
+}
+
+/* Bits 2i, 2i+1 of a 32-bit row to bits 4i, 4i+1: one row's share of
+   every block's byte order at once (her bloğun bir satırlık payı) */
+static ALWAYS_INLINE uint64_t pairs(uint64_t x) {
+    x &= 0xFFFFFFFFull;
+    x = (x | x << 16) & 0x0000FFFF0000FFFFull;
+    x = (x | x << 8)  & 0x00FF00FF00FF00FFull;
+    x = (x | x << 4)  & 0x0F0F0F0F0F0F0F0Full;
+    x = (x | x << 2)  & 0x3333333333333333ull;
+    return x;
+}
+
+static ALWAYS_INLINE uint64_t load8(const uint8_t *p)   { uint64_t v; memcpy(&v, p, 8); return v; }
+static ALWAYS_INLINE void store8(uint8_t *p, uint64_t v) { memcpy(p, &v, 8); }
+
+static ALWAYS_INLINE void neighbors_small(Board *b, const int R, const int C) {
+    Chunk *k = board_touch(b, 0, 0);
+    if (!k) return;
+    uint64_t m[CHUNK_DIM + 3] = {0};   /* row r at m[r + 1], shifted up one bit (satır r, bir bit kaydırılmış) */
+    for (int r = 0; r < R; r += 2)
+        for (int c = 0; c < C; c += 4) {
+            unsigned z = pack8(load8(k->cell + chunk_index(r, c)) >> 4);   /* CELL_MINE */
+            m[r + 1] |= (uint64_t)unzip4(z, 0) << (c + 1);
+            m[r + 2] |= (uint64_t)unzip4(z, 1) << (c + 1);
+        }
+
+    /* Bit-sliced counts of a row pair, its bits put in block byte order:
+       byte i of z[j] holds bit j of the eight counts of block i
+       (satır çiftinin bit dilimli sayıları, blok bayt sırasında) */
+    const uint64_t on_board = ((1ull << C) - 1) << 1;
+    for (int r = 0; r < R; r += 2) {
+        uint64_t z[4] = {0, 0, 0, 0};
+        for (int h = 0; h < 2 && r + h < R; h++) {
+            uint64_t up = m[r + h], mid = m[r + h + 1], dn = m[r + h + 2];
+            uint64_t s1, c1, s2, c2, s3, c3, t1, d1;
+            FULL_ADD(s1, c1, up << 1, up, up >> 1);
+            FULL_ADD(s2, c2, mid << 1, mid >> 1, dn << 1);
+            FULL_ADD(s3, c3, s1, s2, dn);
+            uint64_t ones = s3 ^ (dn >> 1), c4 = s3 & (dn >> 1);
+            FULL_ADD(t1, d1, c1, c2, c3);
+            uint64_t twos = t1 ^ c4, d2 = t1 & c4;
+            z[0] |= pairs(ones >> 1) << 2 * h;
+            z[1] |= pairs(twos >> 1) << 2 * h;
+            z[2] |= pairs((d1 ^ d2) >> 1) << 2 * h;
+            z[3] |= pairs((d1 & d2) >> 1) << 2 * h;
+        }
+        /* Cells past the board in the last block keep their bytes
+           (tahta dışındaki hücreler değişmez) */
+        uint64_t valid = pairs(on_board >> 1) | (r + 1 < R ? pairs(on_board >> 1) << 2 : 0);
+        for (int c = 0; c < C; c += 4) {
+            int sh = 2 * c;
+            uint64_t keep = spread8[(valid >> sh) & 0xFF] * 0x0F;
+            uint64_t n = spread8[(z[0] >> sh) & 0xFF]      | spread8[(z[1] >> sh) & 0xFF] << 1
+                       | spread8[(z[2] >> sh) & 0xFF] << 2 | spread8[(z[3] >> sh) & 0xFF] << 3;
+            uint8_t *p = k->cell + chunk_index(r, c);
+            uint64_t v = load8(p);
+            n &= ~(((v >> 4) & BYTE_LSB) * 0x0F);      /* 0 on mines, branch-free (mayında 0) */
+            store8(p, (v & ~keep) | (n & keep));
+        }
+    }
+}
+#undef FULL_ADD
+#undef BYTE_LSB
+
+#define DEFINE_PRESET(name, R, C, M)                                                        \
+_Static_assert(R <= CHUNK_DIM && C <= 32, "presets must fit one chunk and half a word");   \
+static void neighbors_##name(Board *b) { neighbors_small(b, R, C); }                        \
+static int reveal_##name(Board *b, int r, int c, ChangeSet *out) {                          \
+    Chunk *k0 = board_touch(b, 0, 0);                                                       \
+    return k0 ? reveal_impl(b, k0, R, C, r, c, out) : 0;                                    \
+}
+BOARD_PRESETS(DEFINE_PRESET)
+#undef DEFINE_PRESET
+
+#define PRESET_ENTRY(name, R, C, M) {R, C, neighbors_##name, reveal_##name},
+static const BoardKernels presets[] = { BOARD_PRESETS(PRESET_ENTRY) };
+#undef PRESET_ENTRY
+
+static const BoardKernels *preset_kernels(int rows, int cols) {
+    for (size_t i = 0; i < sizeof presets / sizeof *presets; i++)
+        if (presets[i].rows == rows && presets[i].cols == cols) return &presets[i];
+    return NULL;
+}
+
+/* ── Bit planes (Bit düzlemleri) ─────────────────────────────────────── */
+void board_extract_plane(const Board *b, uint8_t mask, uint8_t want, BitPlane *p) {
+    uint16_t zc[CHUNK_DIM];
+    for (int i = 0; i < CHUNK_DIM; i++) zc[i] = (uint16_t)zorder_spread((unsigned)i);
+    plane_clear(p);
+    for (size_t i = 0, n = chunk_total(b); i < n; i++) {
+        const Chunk *k = b->chunks[i];
+        if (!k && want != 0) continue;          /* untouched chunk reads as all-zero bytes (boş parça) */
+        int r0 = (int)(i / b->chunk_cols) << CHUNK_BITS;
+        int c0 = (int)(i % b->chunk_cols) << CHUNK_BITS;
+        int w  = b->cols - c0 < CHUNK_DIM ? b->cols - c0 : CHUNK_DIM;
+        uint64_t all = w == 64 ? ~0ull : (1ull << w) - 1;
+        /* A chunk row is exactly one word of the plane (parça satırı = bir sözcük) */
+        for (int lr = 0; lr < CHUNK_DIM && r0 + lr < b->rows; lr++) {
+            uint64_t bits = 0;
+            if (!k) {
+                bits = all;
+            } else {
+                const uint8_t *row = k->cell + (zorder_spread((unsigned)lr) << 1);
+                for (int lc = 0; lc < w; lc++)
+                    bits |= (uint64_t)((row[zc[lc]] & mask) == want) << lc;
+            }
+            plane_row(p, r0 + lr)[c0 >> 6] = bits;
+        }
+    }
+}
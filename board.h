@@ -0,0 +1,191 @@
+/*
+ * board.h — portable Minesweeper game core (taşınabilir oyun çekirdeği)
+ *
+ * Pure C, no Win32 dependency: the GUI (mines.c) and the headless
+ * command-line tools share this code. Cells are addressed by (row, col);
+ * the board owns its storage and can be any size that fits in memory.
+ *
+ * (Saf C, Win32 bağımlılığı yok: arayüz ve komut satırı araçları aynı
+ *  kodu paylaşır.)
+ *
+ * Each cell is one packed byte: a 4-bit neighbor count plus mine, revealed
+ * and flagged bits, so every question about a cell is a single load.
+ * Storage is tiled into CHUNK_DIM × CHUNK_DIM chunks that are allocated on
+ * first write. A missing chunk reads as "no mine, hidden, unflagged, zero
+ * neighbors", so a sparse 10^8-cell board only pays for the chunks around
+ * its mines and its openings. Inside a chunk cells are stored in Z-order
+ * (Morton order), keeping the 3×3 neighborhood of a cell within a few
+ * cache lines in every direction.
+ *
+ * (Her hücre tek bir paketli bayttır. Depolama, ilk yazmada ayrılan
+ *  parçalara bölünür; olmayan parça boş hücre gibi okunur. Parça içinde
+ *  hücreler Z-sırasındadır.)
+ */
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bitplane.h"
+
+#define CHUNK_BITS  6
+#define CHUNK_DIM   (1 << CHUNK_BITS)          /* 64 × 64 cells per chunk */
+#define CHUNK_CELLS (CHUNK_DIM * CHUNK_DIM)
+
+/* Packed cell byte (paketli hücre baytı) */
+enum {
+    CELL_COUNT    = 0x0F,                      /* adjacent mines 0–8, 0 on mines (komşu mayın sayısı) */
+    CELL_MINE     = 0x10,
+    CELL_REVEALED = 0x20,
+    CELL_FLAGGED  = 0x40,
+};
+
+/*
+ * Standard sizes (standart boyutlar): X(name, rows, cols, mines). A board
+ * set up with one of these dimensions gets neighbor counting and reveal
+ * compiled for exactly that size — constant loop bounds and edges, the
+ * single chunk addressed directly — instead of the generic code.
+ * (Bu boyutlardaki tahtalar, tam o boyut için derlenmiş sayma ve açma
+ *  kodunu kullanır.)
+ */
+#define BOARD_PRESETS(X)           \
+    X(beginner,       9,  9, 10)   \
+    X(intermediate,  16, 16, 40)   \
+    X(expert,        16, 30, 99)
+
+typedef struct Chunk {
+    uint8_t cell[CHUNK_CELLS];                 /* Z-order (Z-sırası) */
+} Chunk;
+
+typedef struct Board {
+    int  rows, cols, mines;
+    uint64_t seed;            /* fully determines the mine layout (mayın düzenini belirler) */
+    int  revealed_count;
+    bool exploded;            /* a mine was revealed (mayın açıldı) */
+
+    Chunk **chunks;           /* chunk_rows × chunk_cols, NULL until touched (dokunulana dek NULL) */
+    int     chunk_rows, chunk_cols;
+    size_t  chunks_live;
+
+    size_t *stack;            /* reveal work-list, reused across calls (açma iş listesi) */
+    size_t  stack_cap;
+
+    const struct BoardKernels *kern;   /* preset code, NULL = generic; set by board_setup (hazır boyut kodu) */
+} Board;
+
+/*
+ * What one user action changed: each touched cell with its new packed
+ * byte, in the order they changed, plus their bounding box. Actions append
+ * to it, so a caller can gather several before applying them; the buffer
+ * is kept across changes_clear() calls. A UI repaints and invalidates from
+ * it in one pass; a headless consumer can replay or log it.
+ * (Bir kullanıcı eyleminin değiştirdiği hücreler ve yeni baytları, değişim
+ *  sırasıyla, artı sınırlayıcı kutuları. Arayüz tek geçişte uygular.)
+ */
+typedef struct CellChange {
+    int     r, c;
+    uint8_t cell;             /* packed byte after the action (eylemden sonraki bayt) */
+} CellChange;
+
+typedef struct ChangeSet {
+    CellChange *cells;
+    size_t      n, cap;
+    int         r0, c0, r1, c1;   /* bounding box, valid when n > 0 (sınırlayıcı kutu) */
+    bool        oom;          /* some changes were dropped — redraw everything (tümünü yeniden çiz) */
+} ChangeSet;
+
+void changes_clear(ChangeSet *cs);
+void changes_free(ChangeSet *cs);
+void changes_add(ChangeSet *cs, int r, int c, uint8_t cell);
+
+/* (Re)allocate for the given size and clear all state; false on OOM.
+   The chunk table is kept when the dimensions do not change. Picks the
+   preset kernels for BOARD_PRESETS sizes; clearing b->kern afterwards
+   forces the generic code (benchmarks).
+   (Boyut değişmediyse parça tablosu yeniden kullanılır.) */
+bool board_setup(Board *b, int rows, int cols, int mines);
+void board_free(Board *b);
+
+/*
+ * Deal b->mines mines from b->seed. Below one half the mines are drawn;
+ * above it the board starts full and the safe cells are drawn instead, so
+ * each draw succeeds with probability ≥ 1/2 and there are O(min(mines,
+ * safe)) of them. On top of the draws, the old mines are cleared from
+ * every allocated chunk, and a dense deal first fills every cell, so the
+ * total is O(min(mines, safe)) plus O(allocated cells), and O(rows·cols)
+ * above one half. The same seed always gives the same board.
+ * (Az ise mayınlar, çok ise güvenli hücreler çekilir; ayrıca ayrılmış
+ *  parçalar temizlenir ve yoğun dağıtım önce her hücreyi doldurur.)
+ */
+void board_place_mines(Board *b);
+
+/* Same, but keep (r, c) and its eight neighbors mine-free so a first click
+   there opens an area; the zone is dropped if the mines would not fit.
+   (İlk tıklama için (r, c) ve komşuları mayınsız tutulur.) */
+void board_place_mines_around(Board *b, int r, int c);
+void board_compute_neighbors(Board *b);
+
+/*
+ * Reveal (r, c) and, for a zero cell, its whole opening — iteratively, so
+ * stack usage does not depend on the size of the opened region.
+ * Returns the number of cells opened (0 if out of range, revealed or
+ * flagged) and appends each to `out` unless it is NULL. Sets b->exploded
+ * when the cell is a mine.
+ * (Hücreyi ve sıfırsa tüm açıklığı yinelemeli olarak açar; açılanları
+ *  `out`'a ekler.)
+ */
+int  board_reveal(Board *b, int r, int c, ChangeSet *out);
+
+/* Flip the flag on a hidden cell, appending it to `out` unless NULL;
+   false if the cell is already revealed */
+bool board_toggle_flag(Board *b, int r, int c, ChangeSet *out);
+
+/* Allocate the chunk holding (r, c) if needed; NULL on OOM (gerekirse parçayı ayır) */
+Chunk *board_touch(Board *b, int r, int c);
+
+/* ── Cell access (Hücre erişimi) ─────────────────────────────────────── */
+/* Interleave the low CHUNK_BITS of x into the even bits (bitleri araya ser) */
+static inline unsigned zorder_spread(unsigned x) {
+    x &= CHUNK_DIM - 1;
+    x = (x | (x << 4)) & 0x0F0Fu;
+    x = (x | (x << 2)) & 0x3333u;
+    x = (x | (x << 1)) & 0x5555u;
+    return x;
+}
+
+/* Index of (r, c) inside its chunk (parça içi Z-sırası indeksi) */
+static inline unsigned chunk_index(int r, int c) {
+    return zorder_spread((unsigned)c) | (zorder_spread((unsigned)r) << 1);
+}
+
+static inline Chunk *board_chunk(const Board *b, int r, int c) {
+    return b->chunks[(size_t)(r >> CHUNK_BITS) * b->chunk_cols + (c >> CHUNK_BITS)];
+}
+
+/* The packed byte of (r, c); 0 for an untouched chunk (paketli bayt) */
+static inline uint8_t board_cell(const Board *b, int r, int c) {
+    const Chunk *k = board_chunk(b, r, c);
+    return k ? k->cell[chunk_index(r, c)] : 0;
+}
+
+static inline bool board_mine    (const Board *b, int r, int c) { return board_cell(b, r, c) & CELL_MINE; }
+static inline bool board_revealed(const Board *b, int r, int c) { return board_cell(b, r, c) & CELL_REVEALED; }
+static inline bool board_flagged (const Board *b, int r, int c) { return board_cell(b, r, c) & CELL_FLAGGED; }
+
+/* Adjacent mine count, -1 on mines (komşu mayın sayısı, mayında -1) */
+static inline int board_neigh(const Board *b, int r, int c) {
+    uint8_t v = board_cell(b, r, c);
+    return (v & CELL_MINE) ? -1 : (v & CELL_COUNT);
+}
+
+static inline bool board_won(const Board *b) {
+    return !b->exploded && b->revealed_count == b->rows * b->cols - b->mines;
+}
+
+/* Set bit (r, c) of p wherever (cell & mask) == want, e.g. CELL_MINE/CELL_MINE
+   for mines or CELL_COUNT|CELL_MINE/0 for zero cells (hücre maskesini düzleme çıkar) */
+void board_extract_plane(const Board *b, uint8_t mask, uint8_t want, BitPlane *p);
+
+#endif
@@ -5,6 +5,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "board.h"
+#include "rng.h"
+
 /* ── Sabitler ─────────────────────────────────────────────────────────── */
 #define MAX_ROWS  30
 #define MAX_COLS  30
@@ -28,13 +31,10 @@ static int COLS  = 9;
 static int MINES = 10;
 static int lang  = 1;   /* 0 = TR, 1 = EN */
 
-static bool mines_grid[MAX_ROWS][MAX_COLS];
-static bool revealed  [MAX_ROWS][MAX_COLS];
-static bool flagged   [MAX_ROWS][MAX_COLS];
-static int  neigh     [MAX_ROWS][MAX_COLS];
+static Board     board;       /* oyun durumu, mines.c ile aynı çekirdek (board.h) */
+static ChangeSet g_changes;   /* son açmanın değiştirdiği hücreler */
 static HWND buttons   [MAX_ROWS][MAX_COLS];
 static WNDPROC oldButtonProc[MAX_ROWS][MAX_COLS];
-static int  revealedCount = 0;
 static bool g_game_over   = false;
 static HWND mainWindow;
 static HINSTANCE hInst;
@@ -119,52 +119,25 @@ static void idx_from_id(int id, int *r, int *c) {
 }
 
 /* ── Oyun mantığı ────────────────────────────────────────────────────── */
-static void place_mines_randomly(void) {
-    for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++)
-            mines_grid[r][c] = false;
-    int placed = 0;
-    while (placed < MINES) {
-        int r = rand() % ROWS, c = rand() % COLS;
-        if (!mines_grid[r][c]) { mines_grid[r][c] = true; placed++; }
-    }
-}
-
-static void compute_neighbors(void) {
-    for (int r = 0; r < ROWS; r++) {
-        for (int c = 0; c < COLS; c++) {
-            if (mines_grid[r][c]) { neigh[r][c] = -1; continue; }
-            int cnt = 0;
-            for (int dr = -1; dr <= 1; dr++)
-                for (int dc = -1; dc <= 1; dc++) {
-                    if (!dr && !dc) continue;
-                    int rr = r+dr, cc = c+dc;
-                    if (rr >= 0 && rr < ROWS && cc >= 0 && cc < COLS && mines_grid[rr][cc]) cnt++;
-                }
-            neigh[r][c] = cnt;
-        }
-    }
-}
-
+/* Yerleştirme, komşu sayıları ve açma çekirdekte (board.c); 9×9, 16×16 ve
+   16×30 tahtalar o boyut için derlenmiş kodu kullanır */
 void init_game(void) {
-    revealedCount = 0;
-    g_game_over   = false;
+    g_game_over = false;
+    board_setup(&board, ROWS, COLS, MINES);
+    board.seed = rng_mix((uint64_t)time(NULL) ^ ((uint64_t)GetTickCount() << 32));
+    board_place_mines(&board);
+    board_compute_neighbors(&board);
     for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++) {
-            revealed[r][c] = false;
-            flagged [r][c] = false;
+        for (int c = 0; c < COLS; c++)
             if (buttons[r][c]) {
                 SetWindowTextW(buttons[r][c], L"");
                 EnableWindow(buttons[r][c], TRUE);
                 InvalidateRect(buttons[r][c], NULL, TRUE);
             }
-        }
-    place_mines_randomly();
-    compute_neighbors();
 }
 
 static void check_win(void) {
-    if (revealedCount != ROWS * COLS - MINES) return;
+    if (!board_won(&board)) return;
     g_game_over = true;
     MessageBoxW(mainWindow, S(L"win_msg"), S(L"win_title"), MB_OK | MB_ICONINFORMATION);
     for (int r = 0; r < ROWS; r++)
@@ -175,25 +148,35 @@ static void check_win(void) {
 static void reveal_all_mines(void) {
     for (int r = 0; r < ROWS; r++)
         for (int c = 0; c < COLS; c++)
-            if (mines_grid[r][c]) {
+            if (board_mine(&board, r, c)) {
                 SetWindowTextW(buttons[r][c], L"*");
                 EnableWindow(buttons[r][c], FALSE);
                 InvalidateRect(buttons[r][c], NULL, TRUE);
             }
 }
 
-void reveal_cell(int r, int c) {
-    if (r < 0 || r >= ROWS || c < 0 || c >= COLS) return;
-    if (revealed[r][c] || flagged[r][c]) return;
-
-    revealed[r][c] = true;
-    revealedCount++;
+/* Açılan hücreyi butonuna yansıt */
+static void show_cell(int r, int c) {
     HWND btn = buttons[r][c];
     EnableWindow(btn, FALSE);
     InvalidateRect(btn, NULL, TRUE);
 
-    if (mines_grid[r][c]) {
-        SetWindowTextW(btn, L"*");
+    int n = board_neigh(&board, r, c);
+    if (n > 0) {
+        wchar_t buf[4];
+        swprintf(buf, 4, L"%d", n);
+        SetWindowTextW(btn, buf);
+    }
+}
+
+/* Çekirdek açar ve değişen hücreleri bildirir; yalnızca onların butonları
+   güncellenir, kazanma kontrolü tıklama başına bir kez yapılır */
+void reveal_cell(int r, int c) {
+    changes_clear(&g_changes);
+    if (board_reveal(&board, r, c, &g_changes) == 0) return;
+
+    if (board.exploded) {
+        SetWindowTextW(buttons[r][c], L"*");
         reveal_all_mines();
         g_game_over = true;
         MessageBoxW(mainWindow, S(L"lose_msg"), S(L"lose_title"), MB_OK | MB_ICONERROR);
@@ -203,23 +186,7 @@ void reveal_cell(int r, int c) {
         return;
     }
 
-    int n = neigh[r][c];
-    if (n > 0) {
-        wchar_t buf[4];
-        swprintf(buf, 4, L"%d", n);
-        SetWindowTextW(btn, buf);
-    }
-
-    if (n == 0)
-        for (int dr = -1; dr <= 1; dr++)
-            for (int dc = -1; dc <= 1; dc++) {
-                if (!dr && !dc) continue;
-                int rr = r+dr, cc = c+dc;
-                if (rr >= 0 && rr < ROWS && cc >= 0 && cc < COLS
-                    && !revealed[rr][cc] && !mines_grid[rr][cc] && !flagged[rr][cc])
-                    reveal_cell(rr, cc);
-            }
-
+    for (size_t i = 0; i < g_changes.n; i++) show_cell(g_changes.cells[i].r, g_changes.cells[i].c);
     check_win();
 }
 
@@ -397,9 +364,8 @@ LRESULT CALLBACK ButtonProc(HWND hwndBtn, UINT msg, WPARAM wParam, LPARAM lParam
         int id = GetDlgCtrlID(hwndBtn);
         if (id >= BASE_ID && id < BASE_ID + ROWS * COLS) {
             int r, c; idx_from_id(id, &r, &c);
-            if (!revealed[r][c]) {
-                flagged[r][c] = !flagged[r][c];
-                SetWindowTextW(buttons[r][c], flagged[r][c] ? L"F" : L"");
+            if (!g_game_over && board_toggle_flag(&board, r, c, NULL)) {
+                SetWindowTextW(buttons[r][c], board_flagged(&board, r, c) ? L"F" : L"");
                 InvalidateRect(buttons[r][c], NULL, TRUE);
             }
         }
@@ -429,7 +395,7 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
             show_settings_dialog();
         } else if (id >= BASE_ID && id < BASE_ID + ROWS * COLS) {
             int r, c; idx_from_id(id, &r, &c);
-            if (!flagged[r][c] && !revealed[r][c]) reveal_cell(r, c);
+            if (!board_flagged(&board, r, c) && !board_revealed(&board, r, c)) reveal_cell(r, c);
         }
         break;
     }
@@ -442,7 +408,7 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
         int r = idx / COLS, c = idx % COLS;
 
         /* Arka plan */
-        HBRUSH br = CreateSolidBrush(revealed[r][c] ? RGB(192,192,192) : RGB(220,220,220));
+        HBRUSH br = CreateSolidBrush(board_revealed(&board, r, c) ? RGB(192,192,192) : RGB(220,220,220));
         FillRect(dis->hDC, &dis->rcItem, br);
         DeleteObject(br);
 
@@ -458,15 +424,15 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
 
         /* Renk: bayrak kırmızı, rakamlar klasik renklerde */
         COLORREF col = RGB(0,0,0);
-        if (flagged[r][c] && !revealed[r][c]) {
+        if (board_flagged(&board, r, c) && !board_revealed(&board, r, c)) {
             col = RGB(200,0,0);
-        } else if (revealed[r][c] && !mines_grid[r][c]) {
+        } else if (board_revealed(&board, r, c) && !board_mine(&board, r, c)) {
             static const COLORREF numColors[] = {
                 0, RGB(0,0,200), RGB(0,130,0), RGB(200,0,0),
                 RGB(0,0,130), RGB(130,0,0), RGB(0,130,130),
                 RGB(80,80,80), RGB(80,80,80)
             };
-            int n = neigh[r][c];
+            int n = board_neigh(&board, r, c);
             if (n >= 1 && n <= 8) col = numColors[n];
         } else {
             /* Mayın veya devre dışı */
@@ -496,7 +462,6 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
 /* ── Giriş noktası ───────────────────────────────────────────────────── */
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrev, PWSTR pCmd, int nCmdShow) {
     hInst = hInstance;
-    srand((unsigned)time(NULL));
     load_settings();   /* kayıtlı ayarları oku */
 
     /* Ana pencere sınıfı */
@@ -0,0 +1,336 @@
+#include "flood.h"
+#include "thread.h"
+#include "trace.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_WORKERS 64
+#define SEED_BITS   (2 * CHUNK_BITS)
+
+/* A seed is (tile << SEED_BITS) | (local row << CHUNK_BITS) | local col
+   (tohum kodu) */
+typedef size_t Seed;
+
+typedef struct Flood Flood;
+
+typedef struct {
+    Flood    *f;
+    int       id;
+    Seed     *out;                     /* seeds for other tiles (diğer parçalara tohumlar) */
+    size_t    n_out, cap_out;
+    int       opened;
+    size_t    live;                    /* chunks this worker allocated (ayrılan parçalar) */
+    bool      oom;
+    ChangeSet changes;
+    uint64_t  sent[5];                 /* edge cells posted this tile (bu parçada gönderilen kenarlar) */
+    uint16_t *stack;                   /* zero runs to fill, local (doldurulacak sıfır dizileri) */
+    size_t    stack_cap;
+} Worker;
+
+struct Flood {
+    Board    *b;
+    bool      track;                   /* collect changes (değişiklikleri topla) */
+    int       workers;
+    Worker   *w;
+    uint16_t  zr[CHUNK_DIM], zc[CHUNK_DIM];   /* chunk_index = zr[row] | zc[col] (Z-sırası tabloları) */
+
+    size_t   *active;                  /* tiles with seeds this step (bu adımın parçaları) */
+    size_t    n_active;
+    atomic_size_t next;                /* next active tile to claim (sıradaki parça) */
+    uint32_t *cnt;                     /* seeds per tile, n_tiles (parça başına tohum) */
+    size_t   *start;                   /* first seed of each active tile (ilk tohum) */
+    uint16_t *seeds;
+    size_t    cap_seeds;
+
+    atomic_int  go;                    /* worker count is final (işçi sayısı kesin) */
+    atomic_int  arrived;
+    atomic_bool sense;
+};
+
+/* ── Barrier (Bariyer) ───────────────────────────────────────────────── */
+/* Sense-reversing: the last to arrive flips the shared sense and releases
+   the rest (son gelen ortak yönü çevirir ve diğerlerini bırakır) */
+static void barrier(Flood *f, bool *sense) {
+    *sense = !*sense;
+    if (atomic_fetch_add(&f->arrived, 1) == f->workers - 1) {
+        atomic_store(&f->arrived, 0);
+        atomic_store(&f->sense, *sense);
+    } else {
+        while (atomic_load(&f->sense) != *sense) thread_yield();
+    }
+}
+
+/* ── Tile flood (Parça doldurma) ─────────────────────────────────────── */
+static void post(Worker *w, size_t tile, int lr, int lc) {
+    if (w->n_out == w->cap_out) {
+        size_t cap = w->cap_out ? w->cap_out * 2 : 1024;
+        Seed *p = realloc(w->out, cap * sizeof *p);
+        if (!p) { w->oom = true; return; }
+        w->out = p; w->cap_out = cap;
+    }
+    w->out[w->n_out++] = tile << SEED_BITS | (size_t)lr << CHUNK_BITS | (size_t)lc;
+}
+
+/* Hand the cell (lr, lc) just outside the tile to its owner, once per
+   tile flood; lr and lc run -1..CHUNK_DIM, so the ring around the tile
+   has 4 × 66 slots (parça dışındaki hücreyi bir kez sahibine gönder) */
+static void cross(Worker *w, const Board *b, int R0, int C0, int lr, int lc) {
+    int r = R0 + lr, c = C0 + lc;
+    if (r < 0 || r >= b->rows || c < 0 || c >= b->cols) return;
+    unsigned slot = lr < 0          ? (unsigned)(lc + 1)
+                  : lr >= CHUNK_DIM ? 66u + (unsigned)(lc + 1)
+                  : lc < 0          ? 132u + (unsigned)lr
+                  :                   198u + (unsigned)lr;
+    uint64_t bit = 1ull << (slot & 63);
+    if (w->sent[slot >> 6] & bit) return;
+    w->sent[slot >> 6] |= bit;
+    size_t tile = (size_t)(r >> CHUNK_BITS) * b->chunk_cols + (size_t)(c >> CHUNK_BITS);
+    post(w, tile, r & (CHUNK_DIM - 1), c & (CHUNK_DIM - 1));
+}
+
+static bool push(Worker *w, size_t *top, int lr, int lc) {
+    if (*top == w->stack_cap) {
+        size_t cap = w->stack_cap ? w->stack_cap * 2 : 256;
+        uint16_t *s = realloc(w->stack, cap * sizeof *s);
+        if (!s) { w->oom = true; return false; }
+        w->stack = s; w->stack_cap = cap;
+    }
+    w->stack[(*top)++] = (uint16_t)(lr << CHUNK_BITS | lc);
+    return true;
+}
+
+/* The tile's cells, the same tests as the serial reveal (parçanın hücreleri) */
+typedef struct {
+    Worker  *w;
+    Chunk   *k;
+    const uint16_t *zr, *zc;
+    int      R0, C0;
+} Tile;
+
+static inline uint8_t *at(const Tile *t, int lr, int lc) { return &t->k->cell[t->zr[lr] | t->zc[lc]]; }
+
+static inline bool closed(const Tile *t, int lr, int lc) {
+    return !(*at(t, lr, lc) & (CELL_REVEALED | CELL_FLAGGED));
+}
+
+static inline bool fillable(const Tile *t, int lr, int lc) {
+    return !(*at(t, lr, lc) & (CELL_COUNT | CELL_MINE | CELL_REVEALED | CELL_FLAGGED));
+}
+
+static inline void open_local(const Tile *t, int lr, int lc) {
+    uint8_t *v = at(t, lr, lc);
+    *v |= CELL_REVEALED;
+    t->w->opened++;
+    if (t->w->f->track) changes_add(&t->w->changes, t->R0 + lr, t->C0 + lc, *v);
+}
+
+/*
+ * The scanline fill of reveal_impl clipped to one tile: runs stop at the
+ * tile's edge, and every cell of the surrounding ring the fill would
+ * have looked at goes to cross() instead — its owner opens it, and
+ * floods on from it if it is a zero.
+ * (reveal_impl'in tek parçaya kırpılmış hali: parça dışındaki hücreler
+ *  sahibine gönderilir.)
+ */
+static void flood_tile(Worker *w, size_t tile) {
+    Flood *f = w->f;
+    Board *b = f->b;
+    Tile t = {w, b->chunks[tile], f->zr, f->zc,
+              (int)(tile / (size_t)b->chunk_cols) << CHUNK_BITS,
+              (int)(tile % (size_t)b->chunk_cols) << CHUNK_BITS};
+    const int H = b->rows - t.R0 < CHUNK_DIM ? b->rows - t.R0 : CHUNK_DIM;
+    const int W = b->cols - t.C0 < CHUNK_DIM ? b->cols - t.C0 : CHUNK_DIM;
+
+    /* Only this worker touches the tile in this step, its chunk pointer
+       included (bu adımda parçaya yalnızca bu işçi dokunur) */
+    if (!t.k) {
+        if (!(t.k = b->chunks[tile] = calloc(1, sizeof *t.k))) { w->oom = true; return; }
+        w->live++;
+    }
+
+    memset(w->sent, 0, sizeof w->sent);
+    size_t top = 0;
+    const uint16_t *s = f->seeds + f->start[tile];
+    for (uint32_t i = 0; i < f->cnt[tile]; i++) {
+        int lr = s[i] >> CHUNK_BITS, lc = s[i] & (CHUNK_DIM - 1);
+        if (fillable(&t, lr, lc)) { if (!push(w, &top, lr, lc)) return; }
+        else if (closed(&t, lr, lc)) open_local(&t, lr, lc);
+    }
+
+    while (top) {
+        int sr = w->stack[--top] >> CHUNK_BITS, sc = w->stack[top] & (CHUNK_DIM - 1);
+        if (!fillable(&t, sr, sc)) continue;
+
+        int x0 = sc, x1 = sc;
+        while (x0 > 0     && fillable(&t, sr, x0 - 1)) x0--;
+        while (x1 < W - 1 && fillable(&t, sr, x1 + 1)) x1++;
+        for (int x = x0; x <= x1; x++) open_local(&t, sr, x);
+
+        int lo = x0 - 1, hi = x1 + 1;
+        if (lo >= 0) { if (closed(&t, sr, lo)) open_local(&t, sr, lo); }
+        else cross(w, b, t.R0, t.C0, sr, lo);
+        if (hi < W) { if (closed(&t, sr, hi)) open_local(&t, sr, hi); }
+        else cross(w, b, t.R0, t.C0, sr, hi);
+
+        for (int nr = sr - 1; nr <= sr + 1; nr += 2) {
+            if (nr < 0 || nr >= H) {
+                for (int x = lo; x <= hi; x++) cross(w, b, t.R0, t.C0, nr, x);
+                continue;
+            }
+            if (lo < 0)  cross(w, b, t.R0, t.C0, nr, lo);
+            if (hi >= W) cross(w, b, t.R0, t.C0, nr, hi);
+            bool in_run = false;
+            for (int x = lo < 0 ? 0 : lo, end = hi < W ? hi : W - 1; x <= end; x++) {
+                if (fillable(&t, nr, x)) {
+                    if (!in_run && !push(w, &top, nr, x)) return;
+                    in_run = true;
+                } else {
+                    in_run = false;
+                    if (closed(&t, nr, x)) open_local(&t, nr, x);
+                }
+            }
+        }
+    }
+}
+
+/* ── Steps (Adımlar) ─────────────────────────────────────────────────── */
+/* Sort every outbox by tile into the next step's seeds; worker 0 only
+   (tüm giden kutularını parçaya göre sırala) */
+static void gather(Flood *f) {
+    for (size_t i = 0; i < f->n_active; i++) f->cnt[f->active[i]] = 0;
+    f->n_active = 0;
+
+    size_t total = 0;
+    for (int i = 0; i < f->workers; i++) {
+        Worker *w = &f->w[i];
+        total += w->n_out;
+        for (size_t j = 0; j < w->n_out; j++) {
+            size_t tile = w->out[j] >> SEED_BITS;
+            if (f->cnt[tile]++ == 0) f->active[f->n_active++] = tile;
+        }
+    }
+    if (total > f->cap_seeds) {
+        uint16_t *p = realloc(f->seeds, total * sizeof *p);
+        if (!p) {
+            /* Drop the step; the opening stays partial, as a serial
+               reveal out of memory does (adımı bırak, açıklık yarım kalır) */
+            for (int i = 0; i < f->workers; i++) { f->w[i].n_out = 0; f->w[i].oom = true; }
+            for (size_t i = 0; i < f->n_active; i++) f->cnt[f->active[i]] = 0;
+            f->n_active = 0;
+            return;
+        }
+        f->seeds = p; f->cap_seeds = total;
+    }
+
+    size_t at = 0;
+    for (size_t i = 0; i < f->n_active; i++) {
+        size_t tile = f->active[i];
+        f->start[tile] = at;
+        at += f->cnt[tile];
+        f->cnt[tile] = 0;
+    }
+    for (int i = 0; i < f->workers; i++) {
+        Worker *w = &f->w[i];
+        for (size_t j = 0; j < w->n_out; j++) {
+            size_t tile = w->out[j] >> SEED_BITS;
+            f->seeds[f->start[tile] + f->cnt[tile]++] = (uint16_t)(w->out[j] & (CHUNK_CELLS - 1));
+        }
+        w->n_out = 0;
+    }
+    atomic_store(&f->next, 0);
+}
+
+static THREAD_RET worker(void *arg) {
+    Worker *w = arg;
+    Flood  *f = w->f;
+    bool sense = false;
+    while (!atomic_load(&f->go)) thread_yield();
+
+    TRACE_BEGIN("flood worker");
+    for (;;) {
+        size_t i;
+        while ((i = atomic_fetch_add(&f->next, 1)) < f->n_active) flood_tile(w, f->active[i]);
+        barrier(f, &sense);
+        if (w->id == 0) gather(f);
+        barrier(f, &sense);
+        if (!f->n_active) break;
+    }
+    TRACE_END("flood worker");
+    return 0;
+}
+
+static THREAD_RET spawned(void *arg) {
+    worker(arg);
+    TRACE_THREAD_EXIT();
+    return 0;
+}
+
+int board_reveal_parallel(Board *b, int r, int c, int threads, ChangeSet *out) {
+    if (threads <= 0) threads = thread_cpu_count();
+    if (threads > MAX_WORKERS) threads = MAX_WORKERS;
+    size_t n_tiles = (size_t)b->chunk_rows * b->chunk_cols;
+    if (threads < 2 || n_tiles < 2 || r < 0 || r >= b->rows || c < 0 || c >= b->cols
+        || (board_cell(b, r, c) & (CELL_COUNT | CELL_MINE | CELL_REVEALED | CELL_FLAGGED)))
+        return board_reveal(b, r, c, out);
+
+    Flood f = {.b = b, .track = out != NULL};
+    f.w      = calloc((size_t)threads, sizeof *f.w);
+    f.active = malloc(n_tiles * sizeof *f.active);
+    f.cnt    = calloc(n_tiles, sizeof *f.cnt);
+    f.start  = malloc(n_tiles * sizeof *f.start);
+    f.seeds  = malloc(sizeof *f.seeds);
+    if (!f.w || !f.active || !f.cnt || !f.start || !f.seeds) {
+        free(f.w); free(f.active); free(f.cnt); free(f.start); free(f.seeds);
+        return board_reveal(b, r, c, out);
+    }
+    f.cap_seeds = 1;
+    for (int i = 0; i < CHUNK_DIM; i++) {
+        f.zr[i] = (uint16_t)chunk_index(i, 0);
+        f.zc[i] = (uint16_t)chunk_index(0, i);
+    }
+
+    /* Step 0: the clicked cell alone (ilk adım: yalnızca tıklanan hücre) */
+    size_t tile = (size_t)(r >> CHUNK_BITS) * b->chunk_cols + (size_t)(c >> CHUNK_BITS);
+    f.active[f.n_active++] = tile;
+    f.cnt[tile]   = 1;
+    f.start[tile] = 0;
+    f.seeds[0]    = (uint16_t)((r & (CHUNK_DIM - 1)) << CHUNK_BITS | (c & (CHUNK_DIM - 1)));
+    atomic_init(&f.next, 0);
+    atomic_init(&f.go, 0);
+    atomic_init(&f.arrived, 0);
+    atomic_init(&f.sense, false);
+
+    /* The calling thread is worker 0; the barrier counts only the workers
+       that actually started (çağıran 0. işçidir; bariyer başlayanları sayar) */
+    Thread t[MAX_WORKERS];
+    int started = 0;
+    for (int i = 0; i < threads; i++) { f.w[i].f = &f; f.w[i].id = i; }
+    while (started < threads - 1 && thread_start(&t[started], spawned, &f.w[started + 1])) started++;
+    f.workers = started + 1;
+    atomic_store(&f.go, 1);
+    worker(&f.w[0]);
+    for (int i = 0; i < started; i++) thread_join(t[i]);
+
+    int opened = 0;
+    for (int i = 0; i < f.workers; i++) {
+        Worker *w = &f.w[i];
+        opened += w->opened;
+        b->chunks_live += w->live;
+        if (out) {
+            for (size_t j = 0; j < w->changes.n; j++) {
+                const CellChange *x = &w->changes.cells[j];
+                changes_add(out, x->r, x->c, x->cell);
+            }
+            if (w->changes.oom || w->oom) out->oom = true;
+        }
+        changes_free(&w->changes);
+        free(w->out);
+        free(w->stack);
+    }
+    b->revealed_count += opened;
+
+    free(f.w); free(f.active); free(f.cnt); free(f.start); free(f.seeds);
+    return opened;
+}
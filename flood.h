@@ -0,0 +1,35 @@
+/*
+ * flood.h — multi-threaded reveal of large openings (çok çekirdekli açma)
+ *
+ * Opening a zero cell on a huge, sparse board can flood millions of
+ * cells. board_reveal_parallel grows the opening in steps over the
+ * board's chunks (64 × 64 tiles): in each step every tile with pending
+ * seeds is flooded by exactly one worker, which opens cells inside its
+ * tile and posts the seeds that cross a tile edge to a per-worker outbox.
+ * Between steps the outboxes are sorted by tile into the next step's
+ * seeds. A tile is never touched by two workers at once, so cell bytes
+ * need no atomics; the workers only share a tile counter and a barrier.
+ *
+ * The opened cells are exactly those board_reveal opens — both open the
+ * 8-connected zero region and its closed border, stopping at flags — and
+ * revealed_count ends the same; only the order of the changes differs.
+ *
+ * (Büyük bir açıklık parçalar üzerinde adım adım büyütülür: her adımda
+ *  tohumu olan her parçayı tek bir işçi doldurur, kenarı aşan tohumlar
+ *  bir sonraki adıma aktarılır. Açılan hücreler board_reveal ile aynıdır;
+ *  yalnızca değişikliklerin sırası farklıdır.)
+ */
+#ifndef FLOOD_H
+#define FLOOD_H
+
+#include "board.h"
+
+/*
+ * board_reveal on `threads` workers (0 = one per CPU). Falls back to the
+ * serial reveal for anything but a hidden zero cell on a multi-chunk
+ * board, and for threads == 1. Returns the number of cells opened.
+ * (Gizli sıfır hücre ve çok parçalı tahta dışında seri açmaya düşer.)
+ */
+int board_reveal_parallel(Board *b, int r, int c, int threads, ChangeSet *out);
+
+#endif
@@ -0,0 +1,91 @@
+#include "generate.h"
+#include "rng.h"
+#include "solver.h"
+#include "thread.h"
+#include "trace.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#define MAX_WORKERS 64
+
+typedef struct {
+    const Board     *shape;            /* rows, cols, mines, base seed (boyut ve taban tohum) */
+    int              r, c;
+    uint64_t         limit;
+    atomic_uint_fast64_t next;         /* next candidate to hand out (sıradaki aday) */
+    atomic_uint_fast64_t best;         /* lowest solvable candidate so far (çözülen en küçük aday) */
+    atomic_uint_fast64_t tried;
+} Search;
+
+/* Lower s->best to k unless a smaller candidate already won (en küçüğü tut) */
+static void offer(Search *s, uint64_t k) {
+    uint_fast64_t cur = atomic_load(&s->best);
+    while (k < cur && !atomic_compare_exchange_weak(&s->best, &cur, k)) {}
+}
+
+static THREAD_RET worker(void *arg) {
+    Search *s = arg;
+    Board   b = {0};
+    Solver  v = {0};
+    uint64_t tried = 0;
+    TRACE_BEGIN("generate worker");
+    if (board_setup(&b, s->shape->rows, s->shape->cols, s->shape->mines)
+        && solver_setup(&v, s->shape->rows, s->shape->cols)) {
+        for (;;) {
+            uint64_t k = atomic_fetch_add(&s->next, 1);
+            if (k >= s->limit || k >= atomic_load(&s->best)) break;
+            b.seed = rng_stream(s->shape->seed, k);
+            TRACE_BEGIN("deal candidate");
+            board_place_mines_around(&b, s->r, s->c);
+            board_compute_neighbors(&b);
+            TRACE_END("deal candidate");
+            tried++;
+            TRACE_BEGIN("solve candidate");
+            if (solver_solve_from(&v, &b, s->r, s->c)) offer(s, k);
+            TRACE_END("solve candidate");
+        }
+    }
+    atomic_fetch_add(&s->tried, tried);
+    solver_free(&v);
+    board_free(&b);
+    TRACE_END("generate worker");
+    return 0;
+}
+
+/* Threads of their own give their trace ring back before they end
+   (kendi iş parçacıkları izleme halkasını bitmeden geri verir) */
+static THREAD_RET spawned(void *arg) {
+    worker(arg);
+    TRACE_THREAD_EXIT();
+    return 0;
+}
+
+bool generate_no_guess(Board *b, int r, int c, int threads, uint64_t max_candidates, GenStats *st) {
+    if (threads <= 0) threads = thread_cpu_count();
+    if (threads > MAX_WORKERS) threads = MAX_WORKERS;
+
+    Search s = {.shape = b, .r = r, .c = c, .limit = max_candidates};
+    atomic_init(&s.next, 0);
+    atomic_init(&s.best, UINT64_MAX);
+    atomic_init(&s.tried, 0);
+
+    /* The calling thread is worker 0 (çağıran iş parçacığı 0. işçidir) */
+    Thread t[MAX_WORKERS];
+    int started = 0;
+    while (started < threads - 1 && thread_start(&t[started], spawned, &s)) started++;
+    worker(&s);
+    for (int i = 0; i < started; i++) thread_join(t[i]);
+
+    uint64_t best = atomic_load(&s.best);
+    if (st) {
+        st->candidates = atomic_load(&s.tried);
+        st->winner     = best;
+        st->threads    = started + 1;
+    }
+    bool found = best != UINT64_MAX;
+    if (found) b->seed = rng_stream(b->seed, best);
+    board_place_mines_around(b, r, c);
+    board_compute_neighbors(b);
+    return found;
+}
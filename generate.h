@@ -0,0 +1,38 @@
+/*
+ * generate.h — parallel no-guess board generation (tahminsiz tahta üretimi)
+ *
+ * Candidate k is the board dealt from seed rng_stream(base, k) with the
+ * first click kept clear. Workers on every core take candidates in order
+ * and run the deduction solver on each; the lowest k that solves wins, so
+ * the result depends only on (base, click) — not on the thread count or
+ * on which worker finished first.
+ *
+ * (k. aday, rng_stream(base, k) tohumundan dağıtılan tahtadır. Her
+ *  çekirdekteki işçiler adayları sırayla çözer; çözülen en küçük k kazanır,
+ *  sonuç iş parçacığı sayısından bağımsızdır.)
+ */
+#ifndef GENERATE_H
+#define GENERATE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board.h"
+
+typedef struct GenStats {
+    uint64_t candidates;      /* boards dealt and solved (denenen aday sayısı) */
+    uint64_t winner;          /* k of the chosen board (seçilen aday) */
+    int      threads;
+} GenStats;
+
+/*
+ * Deal b (already set up) as a no-guess board for a first click on (r, c),
+ * trying at most max_candidates seeds derived from b->seed on `threads`
+ * workers (0 = one per CPU). On success b->seed is the winning seed and
+ * the board is dealt from it; otherwise b is dealt from b->seed as usual
+ * and false is returned. Flags already on b are kept.
+ * (Başarıda b->seed kazanan tohumdur; aksi halde b her zamanki gibi dağıtılır.)
+ */
+bool generate_no_guess(Board *b, int r, int c, int threads, uint64_t max_candidates, GenStats *st);
+
+#endif
@@ -0,0 +1,328 @@
+#include "grade.h"
+#include "rng.h"
+#include "thread.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_WORKERS 64
+#define BATCH       64        /* boards claimed at a time (tek seferde alınan tahta) */
+#define PAD         2         /* ZiNi border: premiums look two cells out (ZiNi kenar payı) */
+
+#define GRADE_NAME(id, name) name,
+const char *const grade_names[GRADE_COUNT] = { GRADE_METRICS(GRADE_NAME) };
+#undef GRADE_NAME
+
+static bool reserve(void **p, size_t *cap, size_t n, size_t size) {
+    if (n <= *cap) return true;
+    size_t want = *cap * 2 > n ? *cap * 2 : n < 64 ? 64 : n;
+    void *q = realloc(*p, want * size);
+    if (!q) return false;
+    *p = q; *cap = want;
+    return true;
+}
+
+/* Planes are kept while the board size stays (boyut aynıysa düzlem kalır) */
+static bool shape(BitPlane *p, int rows, int cols) {
+    if (p->bits && p->rows == rows && p->cols == cols) return true;
+    plane_free(p);
+    return plane_setup(p, rows, cols);
+}
+
+void grade_free(Grader *g) {
+    plane_free(&g->zeros);
+    plane_free(&g->near);
+    plane_free(&g->safe);
+    free(g->parent);
+    free(g->run_lo);
+    free(g->run_hi);
+    free(g->cell);
+    for (int i = 0; i < 8; i++) free(g->bucket[i]);
+    memset(g, 0, sizeof *g);
+}
+
+/* ── Regions (Bölgeler) ──────────────────────────────────────────────── */
+/* First cell at or after x whose bit equals `set`, or end (x'ten sonra
+   biti `set` olan ilk hücre) */
+static int scan(const uint64_t *row, int x, int end, bool set) {
+    while (x < end) {
+        uint64_t w = set ? row[x >> 6] : ~row[x >> 6];
+        w >>= x & 63;
+        if (w) { x += __builtin_ctzll(w); break; }
+        x = (x | 63) + 1;
+    }
+    return x < end ? x : end;
+}
+
+static uint32_t find(uint32_t *p, uint32_t x) {
+    while (p[x] != x) { p[x] = p[p[x]]; x = p[x]; }   /* path halving (yol yarılama) */
+    return x;
+}
+
+static bool unite(uint32_t *p, uint32_t a, uint32_t b) {
+    a = find(p, a);
+    b = find(p, b);
+    if (a == b) return false;
+    if (a < b) p[b] = a; else p[a] = b;
+    return true;
+}
+
+static bool grow_runs(Grader *g, size_t n) {
+    if (n <= g->runs_cap) return true;
+    size_t cap = g->runs_cap, lo_cap = cap, hi_cap = cap;
+    return reserve((void **)&g->parent, &cap, n, sizeof *g->parent)
+        && reserve((void **)&g->run_lo, &lo_cap, n, sizeof *g->run_lo)
+        && reserve((void **)&g->run_hi, &hi_cap, n, sizeof *g->run_hi)
+        && (g->runs_cap = cap, true);
+}
+
+/*
+ * 8-connected regions of set bits. Each run of a row is united with the
+ * runs of the row above that overlap it widened by one; every successful
+ * union merges two regions, so regions = runs − unions. Only two rows of
+ * runs are ever compared, and the union-find is over runs, not cells.
+ * (Her dizi, üst satırda bir genişletilmiş haliyle örtüşen dizilerle
+ *  birleştirilir; bölge = dizi − başarılı birleşim.)
+ */
+static bool count_regions(Grader *g, const BitPlane *p, uint32_t *out) {
+    const int C = p->cols;
+    size_t n = 0, prev = 0, prev_end = 0, joins = 0;
+    for (int r = 0; r < p->rows; r++) {
+        const uint64_t *row = plane_row(p, r);
+        size_t cur = n, j = prev;
+        for (int x0 = scan(row, 0, C, true); x0 < C; ) {
+            int x1 = scan(row, x0, C, false) - 1;
+            if (!grow_runs(g, n + 1)) return false;
+            g->parent[n] = (uint32_t)n;
+            g->run_lo[n] = x0;
+            g->run_hi[n] = x1;
+            while (j < prev_end && g->run_hi[j] < x0 - 1) j++;
+            for (size_t k = j; k < prev_end && g->run_lo[k] <= x1 + 1; k++)
+                joins += unite(g->parent, (uint32_t)n, (uint32_t)k);
+            n++;
+            x0 = scan(row, x1 + 1, C, true);
+        }
+        prev = cur;
+        prev_end = n;
+    }
+    *out = (uint32_t)(n - joins);
+    return true;
+}
+
+/* ── ZiNi ────────────────────────────────────────────────────────────── */
+/*
+ * Clicks a chord on cell i saves over left-clicking what it opens: the
+ * closed safe cells around it, less one click per mine still to flag and
+ * one for the chord. Opening i first costs a click but opens one of the
+ * cells 3BV counts anyway, so it cancels out. -1 if nothing is closed.
+ * (Akor tıklamasının kazancı: etraftaki kapalı güvenli hücreler eksi
+ *  işaretlenecek mayınlar eksi bir; kapalı yoksa -1.)
+ */
+static int premium(const uint8_t *cell, size_t i, const ptrdiff_t off[8]) {
+    int closed = 0, unflagged = 0;
+    for (int k = 0; k < 8; k++) {
+        uint8_t v = cell[i + off[k]];
+        closed    += !(v & (CELL_MINE | CELL_REVEALED));
+        unflagged += (v & (CELL_MINE | CELL_FLAGGED)) == CELL_MINE;
+    }
+    return closed ? closed - unflagged - 1 : -1;
+}
+
+static bool push(Grader *g, int p, uint32_t i) {
+    if (!reserve((void **)&g->bucket[p], &g->bucket_cap[p], g->bucket_len[p] + 1, sizeof **g->bucket)) return false;
+    g->bucket[p][g->bucket_len[p]++] = i;
+    return true;
+}
+
+/*
+ * Greedy ZiNi: every opening is clicked first, which leaves exactly the
+ * isolated cells closed. Then the chord with the highest premium ≥ 0 is
+ * made — open the cell if needed, flag its mines, chord — until none is
+ * left, and each cell still closed costs a left click. Cells wait in
+ * buckets by premium; a chord changes premiums only within two cells, so
+ * those are pushed again and stale entries are skipped when popped.
+ * (Önce tüm açıklıklar tıklanır; sonra en yüksek kazançlı akor yapılır.
+ *  Hücreler kazanca göre kovalarda bekler; bayat kayıtlar atlanır.)
+ */
+static bool zini(Grader *g, const Board *b, uint32_t isolated, uint32_t *out) {
+    const int R = b->rows, C = b->cols;
+    const size_t W = (size_t)C + 2 * PAD;
+    const ptrdiff_t w = (ptrdiff_t)W;
+    const ptrdiff_t off[8] = {-w - 1, -w, -w + 1, -1, 1, w - 1, w, w + 1};
+    if (!reserve((void **)&g->cell, &g->cell_cap, W * ((size_t)R + 2 * PAD), 1)) return false;
+    uint8_t *cell = g->cell;
+    memset(cell, CELL_REVEALED, W * ((size_t)R + 2 * PAD));   /* border: open and blank (kenar: açık, boş) */
+    for (int r = 0; r < R; r++) {
+        const uint64_t *near = plane_row(&g->near, r);
+        uint8_t *row = cell + (size_t)(r + PAD) * W + PAD;
+        for (int c = 0; c < C; c++)
+            row[c] = (uint8_t)((board_cell(b, r, c) & (CELL_COUNT | CELL_MINE))
+                             | (((near[c >> 6] >> (c & 63)) & 1) ? CELL_REVEALED : 0));
+    }
+
+    for (int p = 0; p < 8; p++) g->bucket_len[p] = 0;
+    int top = -1;
+    for (int r = 0; r < R; r++)
+        for (int c = 0; c < C; c++) {
+            size_t i = (size_t)(r + PAD) * W + PAD + (size_t)c;
+            if ((cell[i] & CELL_MINE) || !(cell[i] & CELL_COUNT)) continue;
+            int p = premium(cell, i, off);
+            if (p < 0) continue;
+            if (!push(g, p, (uint32_t)i)) return false;
+            if (p > top) top = p;
+        }
+
+    uint32_t clicks = 0, closed = isolated;
+    while (top >= 0) {
+        if (!g->bucket_len[top]) { top--; continue; }
+        size_t i = g->bucket[top][--g->bucket_len[top]];
+        if (premium(cell, i, off) != top) continue;   /* stale (bayat) */
+
+        if (!(cell[i] & CELL_REVEALED)) { cell[i] |= CELL_REVEALED; clicks++; closed--; }
+        for (int k = 0; k < 8; k++) {
+            uint8_t *v = &cell[i + off[k]];
+            if ((*v & (CELL_MINE | CELL_FLAGGED)) == CELL_MINE) { *v |= CELL_FLAGGED; clicks++; }
+            else if (!(*v & (CELL_MINE | CELL_REVEALED)))       { *v |= CELL_REVEALED; closed--; }
+        }
+        clicks++;
+
+        for (ptrdiff_t dr = -2; dr <= 2; dr++)
+            for (ptrdiff_t dc = -2; dc <= 2; dc++) {
+                size_t j = (size_t)((ptrdiff_t)i + dr * w + dc);
+                if ((cell[j] & CELL_MINE) || !(cell[j] & CELL_COUNT)) continue;
+                int p = premium(cell, j, off);
+                if (p < 0) continue;
+                if (!push(g, p, (uint32_t)j)) return false;
+                if (p > top) top = p;
+            }
+    }
+    *out = clicks + closed;
+    return true;
+}
+
+/* ── Grading (Derecelendirme) ────────────────────────────────────────── */
+bool grade_board(Grader *g, const Board *b, unsigned want, Grade *out) {
+    memset(out, 0, sizeof *out);
+    const int R = b->rows, C = b->cols;
+    if (!shape(&g->zeros, R, C) || !shape(&g->near, R, C) || !shape(&g->safe, R, C)) return false;
+
+    /* Isolated = safe and not within one cell of a zero; no mine ever is
+       (yalıtık = güvenli ve hiçbir sıfıra komşu değil) */
+    board_extract_plane(b, CELL_COUNT | CELL_MINE, 0, &g->zeros);
+    board_extract_plane(b, CELL_MINE, 0, &g->safe);
+    plane_dilate(&g->zeros, &g->near, PLANE_AUTO);
+    for (int r = 0; r < R; r++) {
+        uint64_t *s = plane_row(&g->safe, r);
+        const uint64_t *n = plane_row(&g->near, r);
+        for (size_t w = 0; w < g->safe.stride; w++) s[w] &= ~n[w];
+    }
+    uint32_t *v = out->value;
+    if (!count_regions(g, &g->zeros, &v[GRADE_OPENINGS])) return false;
+    v[GRADE_ISOLATED] = (uint32_t)plane_count(&g->safe);
+    v[GRADE_3BV]      = v[GRADE_OPENINGS] + v[GRADE_ISOLATED];
+    if ((want & GRADE_WANT_ISLANDS) && !count_regions(g, &g->safe, &v[GRADE_ISLANDS])) return false;
+    if (want & GRADE_WANT_ZINI) {
+        if (!zini(g, b, v[GRADE_ISOLATED], &v[GRADE_ZINI])) return false;
+        v[GRADE_ZINI] += v[GRADE_OPENINGS];
+    }
+    return true;
+}
+
+/* ── Batch grading (Toplu derecelendirme) ────────────────────────────── */
+typedef struct {
+    const GradeConfig *cfg;
+    atomic_uint_fast64_t *next;
+    GradeResult *res;
+    bool oom;
+} Worker;
+
+static bool asked(int m, unsigned want) {
+    return m == GRADE_ISLANDS ? (want & GRADE_WANT_ISLANDS) != 0
+         : m == GRADE_ZINI    ? (want & GRADE_WANT_ZINI) != 0
+         : true;
+}
+
+static void record(GradeResult *res, const Grade *gr, unsigned want) {
+    res->boards++;
+    for (int m = 0; m < GRADE_COUNT; m++) {
+        if (!asked(m, want)) continue;
+        uint32_t x = gr->value[m];
+        res->sum[m] += x;
+        if (x < res->min[m]) res->min[m] = x;
+        if (x > res->max[m]) res->max[m] = x;
+        res->hist[m][x < GRADE_BINS - 1 ? x : GRADE_BINS - 1]++;
+    }
+}
+
+static THREAD_RET worker(void *arg) {
+    Worker *w = arg;
+    const GradeConfig *cfg = w->cfg;
+    Board  b = {0};
+    Grader g = {0};
+    for (;;) {
+        uint64_t lo = atomic_fetch_add(w->next, BATCH), hi = lo + BATCH < cfg->boards ? lo + BATCH : cfg->boards;
+        if (lo >= cfg->boards) break;
+        for (uint64_t k = lo; k < hi; k++) {
+            Grade gr;
+            if (!board_setup(&b, cfg->rows, cfg->cols, cfg->mines)) { w->oom = true; goto done; }
+            b.seed = rng_stream(cfg->seed, k);
+            board_place_mines(&b);
+            board_compute_neighbors(&b);
+            if (!grade_board(&g, &b, cfg->want, &gr)) { w->oom = true; goto done; }
+            record(w->res, &gr, cfg->want);
+        }
+    }
+done:
+    grade_free(&g);
+    board_free(&b);
+    return 0;
+}
+
+bool grade_run(const GradeConfig *cfg, GradeResult *out) {
+    memset(out, 0, sizeof *out);
+    if (cfg->rows <= 0 || cfg->cols <= 0 || cfg->mines < 0
+        || (int64_t)cfg->mines > (int64_t)cfg->rows * cfg->cols)
+        return false;
+    int threads = cfg->threads > 0 ? cfg->threads : thread_cpu_count();
+    if (threads > MAX_WORKERS) threads = MAX_WORKERS;
+    uint64_t batches = (cfg->boards + BATCH - 1) / BATCH;
+    if ((uint64_t)threads > batches) threads = batches ? (int)batches : 1;
+
+    /* Histograms are per worker and summed at the end (histogramlar işçi başına) */
+    Worker w[MAX_WORKERS];
+    atomic_uint_fast64_t next;
+    atomic_init(&next, 0);
+    GradeResult *res = calloc((size_t)threads, sizeof *res);
+    if (!res) return false;
+    for (int i = 0; i < threads; i++) {
+        w[i] = (Worker){cfg, &next, &res[i], false};
+        for (int m = 0; m < GRADE_COUNT; m++) res[i].min[m] = UINT32_MAX;
+    }
+
+    /* The calling thread is worker 0 (çağıran iş parçacığı 0. işçidir) */
+    Thread t[MAX_WORKERS];
+    int started = 0;
+    while (started < threads - 1 && thread_start(&t[started], worker, &w[started + 1])) started++;
+    worker(&w[0]);
+    for (int i = 0; i < started; i++) thread_join(t[i]);
+
+    bool ok = true;
+    for (int m = 0; m < GRADE_COUNT; m++) out->min[m] = UINT32_MAX;
+    for (int i = 0; i < threads; i++) {
+        const GradeResult *r = &res[i];
+        out->boards += r->boards;
+        for (int m = 0; m < GRADE_COUNT; m++) {
+            out->sum[m] += r->sum[m];
+            if (r->min[m] < out->min[m]) out->min[m] = r->min[m];
+            if (r->max[m] > out->max[m]) out->max[m] = r->max[m];
+            for (int k = 0; k < GRADE_BINS; k++) out->hist[m][k] += r->hist[m][k];
+        }
+        ok = ok && !w[i].oom;
+    }
+    for (int m = 0; m < GRADE_COUNT; m++)
+        if (out->min[m] == UINT32_MAX) out->min[m] = 0;
+    out->threads = started + 1;
+    free(res);
+    return ok && out->boards == cfg->boards;
+}
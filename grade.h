@@ -0,0 +1,104 @@
+/*
+ * grade.h — board difficulty metrics (tahta zorluk ölçüleri)
+ *
+ * Grades a dealt board — mines placed and neighbor counts current — by
+ * the community's standard measures:
+ *
+ *   3BV       fewest left clicks that clear the board: one per opening
+ *             plus one per safe cell no opening reaches
+ *   openings  8-connected regions of zero cells
+ *   isolated  numbered cells no opening reaches (3BV − openings)
+ *   islands   8-connected groups of isolated cells
+ *   ZiNi      clicks of a greedy player that flags and chords: openings
+ *             first, then always the chord that saves the most clicks
+ *
+ * 3BV, openings and islands work on bit-planes of the board: isolated
+ * cells are the safe cells outside the zero plane dilated by one, and
+ * regions are counted with union-find over runs of set bits, a row at a
+ * time. Only ZiNi looks at single cells.
+ *
+ * grade_run grades many seeded boards on every core into histograms;
+ * board k is dealt from rng_stream(seed, k), exactly as sim.h deals game
+ * k, so a run depends only on its seed.
+ *
+ * (Dağıtılmış tahtayı 3BV, açıklık, yalıtık hücre, ada ve ZiNi ile
+ *  derecelendirir. İlk üçü bit düzlemleri üzerinde, satır satır dizi
+ *  birleşim-bul ile sayılır. grade_run çok sayıda tohumlu tahtayı tüm
+ *  çekirdeklerde histogramlara derecelendirir.)
+ */
+#ifndef GRADE_H
+#define GRADE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bitplane.h"
+#include "board.h"
+
+/* X(id, name) — one histogram per metric (ölçü başına bir histogram) */
+#define GRADE_METRICS(X)      \
+    X(GRADE_3BV,      "3bv")      \
+    X(GRADE_OPENINGS, "openings") \
+    X(GRADE_ISOLATED, "isolated") \
+    X(GRADE_ISLANDS,  "islands")  \
+    X(GRADE_ZINI,     "zini")
+
+#define GRADE_ID(id, name) id,
+typedef enum { GRADE_METRICS(GRADE_ID) GRADE_COUNT } GradeMetric;
+#undef GRADE_ID
+
+extern const char *const grade_names[GRADE_COUNT];
+
+/* What to compute beyond 3BV, openings and isolated (ek ölçüler) */
+enum {
+    GRADE_WANT_ISLANDS = 1 << 0,
+    GRADE_WANT_ZINI    = 1 << 1,
+    GRADE_WANT_ALL     = GRADE_WANT_ISLANDS | GRADE_WANT_ZINI,
+};
+
+typedef struct Grade {
+    uint32_t value[GRADE_COUNT];   /* by GradeMetric; 0 if not asked for (istenmeyen 0) */
+} Grade;
+
+/* Scratch kept between boards; zero-initialize (tahtalar arası tampon) */
+typedef struct Grader {
+    BitPlane  zeros, near, safe;
+    uint32_t *parent;              /* union-find over runs (diziler üzerinde) */
+    int32_t  *run_lo, *run_hi;
+    size_t    runs_cap;
+    uint8_t  *cell;                /* ZiNi: row-major CELL_* bits (satır öncelikli) */
+    size_t    cell_cap;
+    uint32_t *bucket[8];           /* ZiNi: cells by premium 0…7 (kazanca göre) */
+    size_t    bucket_len[8], bucket_cap[8];
+} Grader;
+
+/* Grade b; `want` adds GRADE_WANT_* metrics. False on OOM
+   (b'yi derecelendir; bellek yoksa false) */
+bool grade_board(Grader *g, const Board *b, unsigned want, Grade *out);
+void grade_free(Grader *g);
+
+/* ── Batch grading (Toplu derecelendirme) ────────────────────────────── */
+#define GRADE_BINS 4096            /* values ≥ GRADE_BINS − 1 share the last bin (son kutu taşma) */
+
+typedef struct GradeConfig {
+    int      rows, cols, mines;
+    uint64_t boards;
+    uint64_t seed;
+    int      threads;              /* 0 = one per CPU (0 = işlemci başına bir) */
+    unsigned want;                 /* GRADE_WANT_* */
+} GradeConfig;
+
+typedef struct GradeResult {
+    uint64_t boards;
+    uint64_t sum[GRADE_COUNT];
+    uint32_t min[GRADE_COUNT], max[GRADE_COUNT];
+    uint64_t hist[GRADE_COUNT][GRADE_BINS];
+    int      threads;
+} GradeResult;
+
+/* Deal and grade cfg->boards boards; false on OOM or bad arguments
+   (tahtaları dağıt ve derecelendir) */
+bool grade_run(const GradeConfig *cfg, GradeResult *out);
+
+#endif
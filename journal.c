@@ -0,0 +1,79 @@
+#include "journal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void journal_clear(Journal *j) {
+    j->n_cells  = 0;
+    j->n_acts   = 0;
+    j->top      = 0;
+    j->top_cell = 0;
+}
+
+void journal_free(Journal *j) {
+    free(j->cells);
+    free(j->acts);
+    memset(j, 0, sizeof *j);
+}
+
+static bool grow(void **p, size_t *cap, size_t need, size_t size) {
+    if (need <= *cap) return true;
+    size_t n = *cap ? *cap : 64;
+    while (n < need) n *= 2;
+    void *q = realloc(*p, n * size);
+    if (!q) return false;
+    *p = q;
+    *cap = n;
+    return true;
+}
+
+bool journal_push(Journal *j, const Board *b, int type, const ChangeSet *cs) {
+    if (cs->oom || cs->n > UINT32_MAX >> 1) { journal_clear(j); return false; }
+    /* Redo history ends here (yineleme geçmişi burada biter) */
+    j->n_acts  = j->top;
+    j->n_cells = j->top_cell;
+    if (!grow((void **)&j->cells, &j->cells_cap, j->n_cells + cs->n, sizeof *j->cells)
+        || !grow((void **)&j->acts, &j->acts_cap, j->n_acts + 1, sizeof *j->acts)) {
+        journal_clear(j);
+        return false;
+    }
+    j->acts[j->n_acts++] = (uint32_t)cs->n << 1 | (uint32_t)type;
+    for (size_t i = 0; i < cs->n; i++)
+        j->cells[j->n_cells++] = (uint32_t)cs->cells[i].r * (uint32_t)b->cols + (uint32_t)cs->cells[i].c;
+    j->top      = j->n_acts;
+    j->top_cell = j->n_cells;
+    return true;
+}
+
+/* Flip the `count` cells from `first` of an action; `on` reapplies a
+   reveal, !on takes it back (bir eylemin hücrelerini çevir) */
+static void flip(const Journal *j, uint32_t act, size_t first, Board *b, bool on, ChangeSet *out) {
+    size_t count = act >> 1;
+    uint8_t bit = (act & 1) == JOURNAL_REVEAL ? CELL_REVEALED : CELL_FLAGGED;
+    for (size_t i = first; i < first + count; i++) {
+        int r = (int)(j->cells[i] / (uint32_t)b->cols), c = (int)(j->cells[i] % (uint32_t)b->cols);
+        uint8_t *v = &board_touch(b, r, c)->cell[chunk_index(r, c)];   /* recorded cells have chunks (kayıtlı hücrenin parçası var) */
+        if (bit == CELL_FLAGGED) *v ^= CELL_FLAGGED;
+        else if (on)             *v |= CELL_REVEALED;
+        else                     *v &= (uint8_t)~CELL_REVEALED;
+        if (bit == CELL_REVEALED && (*v & CELL_MINE)) b->exploded = on;
+        if (out) changes_add(out, r, c, *v);
+    }
+    if (bit == CELL_REVEALED) b->revealed_count += on ? (int)count : -(int)count;
+}
+
+bool journal_undo(Journal *j, Board *b, ChangeSet *out) {
+    if (!journal_can_undo(j)) return false;
+    uint32_t act = j->acts[--j->top];
+    j->top_cell -= act >> 1;
+    flip(j, act, j->top_cell, b, false, out);
+    return true;
+}
+
+bool journal_redo(Journal *j, Board *b, ChangeSet *out) {
+    if (!journal_can_redo(j)) return false;
+    uint32_t act = j->acts[j->top++];
+    flip(j, act, j->top_cell, b, true, out);
+    j->top_cell += act >> 1;
+    return true;
+}
@@ -0,0 +1,54 @@
+/*
+ * journal.h — undo/redo as a journal of deltas (değişiklik günlüğüyle geri al/yinele)
+ *
+ * Every action is stored as the cells it changed — for a reveal the whole
+ * opening, for a flag the one cell — taken from the action's ChangeSet, at
+ * four bytes per cell plus four per action. Nothing is copied from the
+ * board, so memory grows with the actions taken, not with the board size.
+ * Undoing or redoing an action flips the revealed or flagged bit on
+ * exactly those cells, so its cost is the size of the action, and each
+ * flipped cell goes to a ChangeSet for the UI to repaint.
+ *
+ * (Her eylem değiştirdiği hücreler olarak, hücre başına dört baytla
+ *  saklanır; tahtanın kopyası tutulmaz. Geri alma ve yineleme yalnızca bu
+ *  hücreleri çevirir; maliyeti eylemin boyutu kadardır.)
+ */
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+
+enum { JOURNAL_REVEAL, JOURNAL_FLAG };
+
+typedef struct Journal {
+    uint32_t *cells;          /* r * cols + c of each changed cell, action after action (değişen hücreler) */
+    size_t    n_cells, cells_cap;
+    uint32_t *acts;           /* cell count << 1 | type (hücre sayısı ve tür) */
+    size_t    n_acts, acts_cap;
+    size_t    top;            /* actions in effect; those above can be redone (geçerli eylemler) */
+    size_t    top_cell;       /* cells of those actions (onların hücreleri) */
+} Journal;
+
+/* Forget every action, keeping the buffers (tüm eylemleri unut) */
+void journal_clear(Journal *j);
+void journal_free(Journal *j);
+
+/* Record an action from the ChangeSet it filled, dropping anything that
+   could be redone. An action whose change-set overflowed cannot be
+   undone, so the history is cleared instead; false then or on OOM.
+   (Eylemi değişiklik kümesinden kaydet; yinelenebilecekler atılır.) */
+bool journal_push(Journal *j, const Board *b, int type, const ChangeSet *cs);
+
+static inline bool journal_can_undo(const Journal *j) { return j->top > 0; }
+static inline bool journal_can_redo(const Journal *j) { return j->top < j->n_acts; }
+
+/* Take back / reapply one action, appending its cells to `out` unless
+   NULL; false if there is none (bir eylemi geri al / yinele) */
+bool journal_undo(Journal *j, Board *b, ChangeSet *out);
+bool journal_redo(Journal *j, Board *b, ChangeSet *out);
+
+#endif
@@ -0,0 +1,63 @@
+#include "lang.h"
+
+#include <string.h>
+
+#define LANG_KEY(id, key, tr, en) [id] = key,
+const char *const lang_keys[STR_COUNT] = { LANG_STRINGS(LANG_KEY) };
+#undef LANG_KEY
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/* A NUL-terminated key at off, or NULL (dosya içinde biten anahtar) */
+static const char *key_at(const uint8_t *d, size_t size, uint32_t off) {
+    if (off >= size || !memchr(d + off, 0, size - off)) return NULL;
+    return (const char *)(d + off);
+}
+
+/* An aligned, NUL-terminated UTF-16 text at off, or NULL (hizalı, biten metin) */
+static const uint16_t *text_at(const uint8_t *d, size_t size, uint32_t off) {
+    if (off >= size || (off & 1) || ((uintptr_t)d & 1)) return NULL;
+    const uint16_t *t = (const uint16_t *)(const void *)(d + off);
+    for (size_t i = 0, n = (size - off) / 2; i < n; i++)
+        if (t[i] == 0) return t;
+    return NULL;
+}
+
+static bool header_ok(const uint8_t *d, size_t size, uint32_t *count) {
+    if (size < LANG_HEADER || memcmp(d, LANG_MAGIC, 4) != 0 || rd32(d + 4) != LANG_VERSION) return false;
+    *count = rd32(d + 8);
+    return *count <= (size - LANG_HEADER) / 8;
+}
+
+const uint16_t *lang_pack_name(const void *data, size_t size) {
+    const uint8_t *d = data;
+    uint32_t count;
+    return header_ok(d, size, &count) ? text_at(d, size, rd32(d + 12)) : NULL;
+}
+
+bool lang_parse(LangPack *p, const void *data, size_t size) {
+    const uint8_t *d = data;
+    uint32_t count;
+    memset(p, 0, sizeof *p);
+    if (!header_ok(d, size, &count) || !(p->name = text_at(d, size, rd32(d + 12)))) return false;
+
+    const uint8_t *index = d + LANG_HEADER;
+    for (int id = 0; id < STR_COUNT; id++) {
+        uint32_t lo = 0, hi = count;
+        while (lo < hi) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            const char *k = key_at(d, size, rd32(index + 8 * mid));
+            if (!k) return false;
+            int cmp = strcmp(k, lang_keys[id]);
+            if (cmp == 0) {
+                if (!(p->str[id] = text_at(d, size, rd32(index + 8 * mid + 4)))) return false;
+                break;
+            }
+            if (cmp < 0) lo = mid + 1;
+            else         hi = mid;
+        }
+    }
+    return true;
+}
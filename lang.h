@@ -0,0 +1,96 @@
+/*
+ * lang.h — string IDs and language packs (metin kimlikleri ve dil paketleri)
+ *
+ * Every UI string has a compile-time ID, so a lookup is one array index.
+ * Turkish and English are built in; further languages come from pack
+ * files (*.lng) that are memory-mapped as they are and parsed in place:
+ * a small header, an index of (key, text) offsets sorted by key, and the
+ * texts as NUL-terminated UTF-16LE. Opening a pack resolves every ID once
+ * by binary search over that index; after that, lookups never touch the
+ * file format again. Packs are built from "key = text" sources by
+ * langpack.c.
+ *
+ * (Her arayüz metninin derleme zamanı kimliği vardır; arama tek dizi
+ *  indekslemesidir. Türkçe ve İngilizce gömülüdür; diğer diller belleğe
+ *  eşlenen paket dosyalarından gelir. Paket açılırken her kimlik bir kez
+ *  ikili aramayla çözülür.)
+ */
+#ifndef LANG_H
+#define LANG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* X(id, key, Turkish, English) */
+#define LANG_STRINGS(X)                                                                              \
+    X(STR_WIN_MSG,       "win_msg",       L"Tebrikler — kazandın!",        L"Congratulations — you won!")  \
+    X(STR_WIN_TITLE,     "win_title",     L"Kazandın",                      L"You Won")                     \
+    X(STR_WIN_TIME,      "win_time",      L"Süre",                          L"Time")                        \
+    X(STR_LOSE_MSG,      "lose_msg",      L"Mayına bastın! Oyun bitti.",    L"You hit a mine! Game over.")  \
+    X(STR_LOSE_TITLE,    "lose_title",    L"Oyun Bitti",                    L"Game Over")                   \
+    X(STR_MENU_GAME,     "menu_game",     L"Oyun",                          L"Game")                        \
+    X(STR_MENU_NEW,      "menu_new",      L"Yeni Oyun",                     L"New Game")                    \
+    X(STR_MENU_UNDO,     "menu_undo",     L"Geri Al",                       L"Undo")                        \
+    X(STR_MENU_REDO,     "menu_redo",     L"Yinele",                        L"Redo")                        \
+    X(STR_MENU_NO_GUESS, "menu_no_guess", L"Tahminsiz Tahtalar",            L"No-Guess Boards")             \
+    X(STR_MENU_STATS,    "menu_stats",    L"İstatistikler",                 L"Statistics")                  \
+    X(STR_MENU_OPTIONS,  "menu_options",  L"Seçenekler",                    L"Options")                     \
+    X(STR_MENU_LANG,     "menu_lang",     L"Dil",                           L"Language")                    \
+    X(STR_MENU_SETTINGS, "menu_settings", L"Oyun Ayarları",                 L"Game Settings")               \
+    X(STR_MENU_ZOOM_IN,  "menu_zoom_in",  L"Yakınlaştır",                   L"Zoom In")                     \
+    X(STR_MENU_ZOOM_OUT, "menu_zoom_out", L"Uzaklaştır",                    L"Zoom Out")                    \
+    X(STR_MENU_ZOOM_FIT, "menu_zoom_fit", L"Tahtayı Sığdır",                L"Fit Board")                   \
+    X(STR_DLG_TITLE,     "dlg_title",     L"Oyun Ayarları",                 L"Game Settings")               \
+    X(STR_LBL_ROWS,      "lbl_rows",      L"Satır Sayısı (1-10000):",       L"Rows (1-10000):")             \
+    X(STR_LBL_COLS,      "lbl_cols",      L"Sütun Sayısı (1-10000):",       L"Columns (1-10000):")          \
+    X(STR_LBL_MINES,     "lbl_mines",     L"Mayın Sayısı:",                 L"Mines:")                      \
+    X(STR_LBL_SEED,      "lbl_seed",      L"Tohum (boş = rastgele):",       L"Seed (blank = random):")      \
+    X(STR_SEED,          "seed",          L"tohum",                         L"seed")                        \
+    X(STR_OK,            "ok",            L"Tamam",                         L"OK")                          \
+    X(STR_CANCEL,        "cancel",        L"İptal",                         L"Cancel")                      \
+    X(STR_ERR_INVALID,   "err_invalid",                                                                  \
+      L"Geçersiz değerler!\nSatır/Sütun: 1-10000, Mayın: 1 ila (satır×sütun-1).",                       \
+      L"Invalid values!\nRows/Cols: 1-10000, Mines: 1 to (rows×cols-1).")                                  \
+    X(STR_ERR_SEED,      "err_seed",                                                                     \
+      L"Geçersiz tohum! En fazla 16 onaltılık basamak girin.",                                          \
+      L"Invalid seed! Enter up to 16 hexadecimal digits.")
+
+#define LANG_ID(id, key, tr, en) id,
+typedef enum { LANG_STRINGS(LANG_ID) STR_COUNT } StrId;
+#undef LANG_ID
+
+extern const char *const lang_keys[STR_COUNT];
+
+/* ── Pack file format (Paket dosya biçimi) ───────────────────────────── */
+/*
+ *   0   "MLNG"
+ *   4   u32 version (LANG_VERSION)
+ *   8   u32 count          entries in the index (dizindeki girdi)
+ *  12   u32 name           offset of the language's own name, UTF-16LE (dilin adı)
+ *  16   count × {u32 key, u32 text}, sorted by key bytes (anahtara göre sıralı)
+ *
+ * All integers little-endian; keys are ASCII, texts 2-byte aligned
+ * UTF-16LE, both NUL-terminated inside the file.
+ * (Tüm tamsayılar küçük sonlu; metinler 2 bayt hizalı UTF-16LE.)
+ */
+#define LANG_MAGIC   "MLNG"
+#define LANG_VERSION 1
+#define LANG_HEADER  16
+
+typedef struct LangPack {
+    const uint16_t *name;
+    const uint16_t *str[STR_COUNT];   /* NULL where the pack has no text (paket metni yoksa NULL) */
+} LangPack;
+
+/*
+ * Resolve every ID against a pack image (e.g. a mapped file), which must
+ * stay valid while p is used. Returns false on a malformed image.
+ * (Her kimliği paket görüntüsünde çöz; görüntü p kullanıldıkça geçerli kalmalı.)
+ */
+bool lang_parse(LangPack *p, const void *data, size_t size);
+
+/* Only the language name, without resolving the index (yalnızca dil adı) */
+const uint16_t *lang_pack_name(const void *data, size_t size);
+
+#endif
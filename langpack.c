@@ -0,0 +1,160 @@
+/*
+ * langpack.c — build a language pack for mines.exe (dil paketi derleyici)
+ *
+ *   gcc -O2 langpack.c lang.c -o langpack
+ *   ./langpack lang/de.txt lang/de.lng
+ *
+ * The source is UTF-8, one "key = text" per line; "@name = …" is the
+ * language's own name for the Language menu, "#" starts a comment and
+ * "\n" in a text is a line break. Keys are those of LANG_STRINGS in
+ * lang.h: unknown keys are reported and dropped, missing ones are
+ * reported and fall back to English at run time. Copy the .lng file into
+ * a "lang" folder next to mines.exe.
+ *
+ * (Kaynak UTF-8'dir, satır başına "anahtar = metin"; "@name" menüde
+ *  görünen dil adıdır. Bilinmeyen anahtarlar atılır, eksikler çalışırken
+ *  İngilizceye düşer. .lng dosyasını mines.exe yanındaki "lang" klasörüne
+ *  kopyalayın.)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lang.h"
+
+typedef struct {
+    char     *key;
+    uint16_t *text;           /* UTF-16, NUL-terminated (NUL ile biten) */
+    size_t    len;            /* code units, NUL included (NUL dahil birim) */
+} Entry;
+
+static int by_key(const void *a, const void *b) {
+    return strcmp(((const Entry *)a)->key, ((const Entry *)b)->key);
+}
+
+static char *trim(char *s) {
+    while (*s == ' ' || *s == '\t') s++;
+    char *e = s + strlen(s);
+    while (e > s && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\r' || e[-1] == '\n')) e--;
+    *e = 0;
+    return s;
+}
+
+/* UTF-8 with "\n" escapes to UTF-16; NULL on bad input (UTF-8'den UTF-16'ya) */
+static uint16_t *to_utf16(const char *s, size_t *len) {
+    size_t n = strlen(s);
+    uint16_t *out = malloc((n + 1) * sizeof *out), *o = out;
+    if (!out) return NULL;
+    const unsigned char *p = (const unsigned char *)s;
+    while (*p) {
+        unsigned long cp;
+        int more;
+        if (p[0] == '\\' && p[1] == 'n') { *o++ = '\n'; p += 2; continue; }
+        if (p[0] == '\\' && p[1] == '\\') { *o++ = '\\'; p += 2; continue; }
+        if      (*p < 0x80)           { cp = *p;        more = 0; }
+        else if ((*p & 0xE0) == 0xC0) { cp = *p & 0x1F; more = 1; }
+        else if ((*p & 0xF0) == 0xE0) { cp = *p & 0x0F; more = 2; }
+        else if ((*p & 0xF8) == 0xF0) { cp = *p & 0x07; more = 3; }
+        else { free(out); return NULL; }
+        p++;
+        for (int i = 0; i < more; i++, p++) {
+            if ((*p & 0xC0) != 0x80) { free(out); return NULL; }
+            cp = cp << 6 | (*p & 0x3F);
+        }
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            *o++ = (uint16_t)(0xD800 | cp >> 10);
+            *o++ = (uint16_t)(0xDC00 | (cp & 0x3FF));
+        } else {
+            *o++ = (uint16_t)cp;
+        }
+    }
+    *o++ = 0;
+    *len = (size_t)(o - out);
+    return out;
+}
+
+static void put32(FILE *f, uint32_t v) {
+    unsigned char b[4] = {(unsigned char)v, (unsigned char)(v >> 8), (unsigned char)(v >> 16), (unsigned char)(v >> 24)};
+    fwrite(b, 1, 4, f);
+}
+
+static void put_text(FILE *f, const uint16_t *t, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        unsigned char b[2] = {(unsigned char)t[i], (unsigned char)(t[i] >> 8)};
+        fwrite(b, 1, 2, f);
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) { fprintf(stderr, "usage: %s source.txt pack.lng\n", argv[0]); return 2; }
+    FILE *in = fopen(argv[1], "r");
+    if (!in) { perror(argv[1]); return 1; }
+
+    Entry e[STR_COUNT];
+    int n = 0, line_no = 0, bad = 0;
+    uint16_t *name = NULL;
+    size_t name_len = 0;
+    char line[4096];
+    while (fgets(line, sizeof line, in)) {
+        line_no++;
+        char *s = line;
+        if (line_no == 1 && (unsigned char)s[0] == 0xEF && (unsigned char)s[1] == 0xBB && (unsigned char)s[2] == 0xBF)
+            s += 3;                                     /* UTF-8 BOM */
+        s = trim(s);
+        if (!*s || *s == '#') continue;
+        char *eq = strchr(s, '=');
+        if (!eq) { fprintf(stderr, "%s:%d: expected key = text\n", argv[1], line_no); bad = 1; continue; }
+        *eq = 0;
+        char *key = trim(s), *text = trim(eq + 1);
+        size_t len;
+        uint16_t *t = to_utf16(text, &len);
+        if (!t) { fprintf(stderr, "%s:%d: invalid UTF-8\n", argv[1], line_no); bad = 1; continue; }
+        if (strcmp(key, "@name") == 0) { free(name); name = t; name_len = len; continue; }
+
+        int id = 0;
+        while (id < STR_COUNT && strcmp(lang_keys[id], key) != 0) id++;
+        if (id == STR_COUNT) { fprintf(stderr, "%s:%d: unknown key '%s'\n", argv[1], line_no, key); free(t); continue; }
+        int j = 0;
+        while (j < n && strcmp(e[j].key, key) != 0) j++;
+        if (j < n) { fprintf(stderr, "%s:%d: duplicate key '%s'\n", argv[1], line_no, key); free(t); bad = 1; continue; }
+        e[n].key  = (char *)lang_keys[id];
+        e[n].text = t;
+        e[n].len  = len;
+        n++;
+    }
+    fclose(in);
+    if (!name) { fprintf(stderr, "%s: missing @name\n", argv[1]); bad = 1; }
+    if (bad) return 1;
+    for (int id = 0; id < STR_COUNT; id++) {
+        int j = 0;
+        while (j < n && strcmp(e[j].key, lang_keys[id]) != 0) j++;
+        if (j == n) fprintf(stderr, "%s: no text for '%s', English is used\n", argv[1], lang_keys[id]);
+    }
+    qsort(e, (size_t)n, sizeof *e, by_key);
+
+    /* Layout: header, index, name, texts, then keys (düzen) */
+    uint32_t off = LANG_HEADER + 8u * (uint32_t)n;
+    uint32_t name_off = off;
+    off += 2u * (uint32_t)name_len;
+    uint32_t text_off[STR_COUNT], key_off[STR_COUNT];
+    for (int i = 0; i < n; i++) { text_off[i] = off; off += 2u * (uint32_t)e[i].len; }
+    for (int i = 0; i < n; i++) { key_off[i] = off; off += (uint32_t)strlen(e[i].key) + 1; }
+
+    FILE *out = fopen(argv[2], "wb");
+    if (!out) { perror(argv[2]); return 1; }
+    fwrite(LANG_MAGIC, 1, 4, out);
+    put32(out, LANG_VERSION);
+    put32(out, (uint32_t)n);
+    put32(out, name_off);
+    for (int i = 0; i < n; i++) { put32(out, key_off[i]); put32(out, text_off[i]); }
+    put_text(out, name, name_len);
+    for (int i = 0; i < n; i++) put_text(out, e[i].text, e[i].len);
+    for (int i = 0; i < n; i++) fwrite(e[i].key, 1, strlen(e[i].key) + 1, out);
+    if (fclose(out) != 0) { perror(argv[2]); return 1; }
+
+    printf("%s: %d of %d strings\n", argv[2], n, STR_COUNT);
+    for (int i = 0; i < n; i++) free(e[i].text);
+    free(name);
+    return 0;
+}
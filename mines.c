@@ -1,77 +1,167 @@
 #include <windows.h>
+#include <windowsx.h>
 #include <wchar.h>
 #include <stdlib.h>
 #include <time.h>
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "board.h"
+#include "flood.h"
+#include "generate.h"
+#include "grade.h"
+#include "lang.h"
+#include "openings.h"
+#include "pool.h"
+#include "replay.h"
+#include "snapshot.h"
+#include "journal.h"
+#include "stats.h"
+#include "thread.h"
+#include "trace.h"
+#include "rng.h"
+
 /* ── Constants (Sabitler) ─────────────────────────────────────────────── */
-#define MAX_ROWS   30
-#define MAX_COLS   30
-#define MIN_CELL   12     /* minimum cell pixel size (minimum hücre piksel boyutu) */
+#define MAX_ROWS   10000
+#define MAX_COLS   10000
+#define MIN_CELL   12     /* smallest cell when fitting the board (sığdırırken en küçük hücre) */
 #define DEF_CELL   36     /* default cell size for initial window sizing (varsayılan hücre boyutu) */
-#define BASE_ID    1000
+#define MIN_ZOOM   4      /* zoom range in pixels per cell (piksel cinsinden yakınlaştırma aralığı) */
+#define MAX_ZOOM   96
+#define NOGUESS_MAX_CANDIDATES 200000   /* give up and deal normally after this many (bu kadar denemeden sonra vazgeç) */
+#define NOGUESS_MAX_CELLS      250000   /* larger boards are dealt normally (daha büyük tahtalar normal dağıtılır) */
+#define PARALLEL_REVEAL_CELLS  (1 << 20) /* boards this large open on every core (bu boyuttan itibaren tüm çekirdeklerde açılır) */
 
 #define IDM_NEW_GAME   2001
 #define IDM_LANG_TR    2002
 #define IDM_LANG_EN    2003
 #define IDM_SETTINGS   2004
+#define IDM_NO_GUESS   2005
+#define IDM_UNDO       2006
+#define IDM_REDO       2007
+#define IDM_STATS      2008
+#define IDM_ZOOM_IN    2009
+#define IDM_ZOOM_OUT   2010
+#define IDM_ZOOM_FIT   2011
+#define IDM_LANG_PACK  2100   /* + pack index (+ paket sırası) */
+#define MAX_PACKS      64
 
 #define IDC_ROWS_EDIT   301
 #define IDC_COLS_EDIT   302
 #define IDC_MINES_EDIT  303
 #define IDC_OK_BTN      304
 #define IDC_CANCEL_BTN  305
+#define IDC_SEED_EDIT   306
 
 /* ── Game state defaults (Oyun durumu varsayılanları) ────────────────── */
 static int ROWS  = 9;
 static int COLS  = 9;
 static int MINES = 10;
-static int lang  = 1;   /* 0 = TR, 1 = EN */
+static int lang  = 1;   /* 0 = TR, 1 = EN, 2 = the pack in g_pack_file (paket) */
+static bool no_guess = false;   /* deal solvable-without-guessing boards (tahminsiz tahtalar) */
 
 /* current dynamic cell size — updated by relayout() (dinamik hücre boyutu) */
 static int cell_size = DEF_CELL;
 
-static bool mines_grid[MAX_ROWS][MAX_COLS];
-static bool revealed  [MAX_ROWS][MAX_COLS];
-static bool flagged   [MAX_ROWS][MAX_COLS];
-static int  neigh     [MAX_ROWS][MAX_COLS];
-static HWND buttons   [MAX_ROWS][MAX_COLS];
-static WNDPROC oldButtonProc[MAX_ROWS][MAX_COLS];
-static int  revealedCount = 0;
+static Board board;       /* game state, see board.h (oyun durumu) */
+static ChangeSet g_changes;       /* cells the current action changed (eylemin değiştirdiği hücreler) */
+static Journal   g_journal;       /* undo/redo history of this game (bu oyunun geri alma geçmişi) */
+static Openings  g_openings;      /* zero regions of the dealt board (dağıtılan tahtanın sıfır bölgeleri) */
+static bool      g_index_lazy;    /* resumed: index at the first reveal (sürdürüldü: ilk açmada dizinle) */
+static uint32_t  g_bv;            /* 3BV of the dealt board, 0 = unknown (dağıtılan tahtanın 3BV'si) */
+static BoardPool g_pool;          /* boards dealt ahead for New Game (Yeni Oyun için önceden dağıtılanlar) */
 static bool g_game_over   = false;
+static bool g_show_mines  = false;   /* lost: draw every mine (kaybedildi: tüm mayınları göster) */
+static bool     g_seed_set = false;     /* next game uses g_seed_next (sonraki oyun verilen tohumu kullanır) */
+static uint64_t g_seed_next;
+static bool     g_deal_pending = false; /* no-guess: mines are dealt on the first click (ilk tıklamada dağıtılır) */
+static bool     g_deal_direct  = false; /* seed was given: deal it as-is, no search (verilen tohum aynen kullanılır) */
+static Replay    g_replay;                /* this game's clicks (bu oyunun tıklamaları) */
+static bool      g_replay_pending;        /* lost, replay not saved yet (kaybedildi, kayıt yazılmadı) */
+static ULONGLONG g_game_t0;               /* tick count at the deal (dağıtım anı) */
+static Stats     g_stats;                 /* always-on counters, see stats.h (her zaman açık sayaçlar) */
 static HWND mainWindow;
+static HWND gridWnd;
 static HINSTANCE hInst;
 
 /* ── Localization (Yerelleştirme) ─────────────────────────────────────── */
-typedef struct { const wchar_t *key, *tr, *en; } StrEntry;
-
-static const StrEntry str_table[] = {
-    {L"win_msg",       L"Tebrikler — kazandın!",                       L"Congratulations — you won!"},
-    {L"win_title",     L"Kazandın",                                     L"You Won"},
-    {L"lose_msg",      L"Mayına bastın! Oyun bitti.",                   L"You hit a mine! Game over."},
-    {L"lose_title",    L"Oyun Bitti",                                   L"Game Over"},
-    {L"menu_game",     L"Oyun",                                         L"Game"},
-    {L"menu_new",      L"Yeni Oyun",                                    L"New Game"},
-    {L"menu_options",  L"Seçenekler",                                   L"Options"},
-    {L"menu_lang",     L"Dil",                                          L"Language"},
-    {L"menu_settings", L"Oyun Ayarları",                                L"Game Settings"},
-    {L"dlg_title",     L"Oyun Ayarları",                                L"Game Settings"},
-    {L"lbl_rows",      L"Satır Sayısı (1-30):",                         L"Rows (1-30):"},
-    {L"lbl_cols",      L"Sütun Sayısı (1-30):",                         L"Columns (1-30):"},
-    {L"lbl_mines",     L"Mayın Sayısı:",                                L"Mines:"},
-    {L"ok",            L"Tamam",                                        L"OK"},
-    {L"cancel",        L"İptal",                                        L"Cancel"},
-    {L"err_invalid",   L"Geçersiz değerler!\nSatır/Sütun: 1-30, Mayın: 1 ila (satır×sütun-1).",
-                       L"Invalid values!\nRows/Cols: 1-30, Mines: 1 to (rows×cols-1)."},
-    {NULL, NULL, NULL}
-};
+/*
+ * S(id) is one load from g_str, the table of the current language. A
+ * pack is mapped read-only and its texts are used in place (UTF-16LE is
+ * wchar_t on Windows); IDs it lacks fall back to English. Packs in the
+ * "lang" folder next to the executable are only listed when the Language
+ * menu is opened, so adding one costs nothing at startup.
+ * (S(id) geçerli dil tablosundan tek okumadır. Paket salt okunur eşlenir
+ *  ve metinleri yerinde kullanılır; eksikler İngilizceye düşer. Paketler
+ *  yalnızca Dil menüsü açılınca listelenir.)
+ */
+#define LANG_TR(id, key, tr, en) [id] = tr,
+#define LANG_EN(id, key, tr, en) [id] = en,
+static const wchar_t *const str_tr[STR_COUNT] = { LANG_STRINGS(LANG_TR) };
+static const wchar_t *const str_en[STR_COUNT] = { LANG_STRINGS(LANG_EN) };
+#undef LANG_TR
+#undef LANG_EN
+
+static const wchar_t *g_str[STR_COUNT];
+static wchar_t g_pack_file[MAX_PATH];          /* file name of the pack in use (kullanılan paket) */
+static HANDLE  g_pack_map;
+static const void *g_pack_view;
+
+static inline const wchar_t *S(StrId id) { return g_str[id]; }
+
+/* Map a pack or snapshot read-only; NULL on failure (dosyayı salt okunur eşle) */
+static const void *map_file(const wchar_t *path, HANDLE *map, size_t *size) {
+    *map = NULL;
+    HANDLE f = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (f == INVALID_HANDLE_VALUE) return NULL;
+    LARGE_INTEGER sz;
+    const void *view = NULL;
+    if (GetFileSizeEx(f, &sz) && sz.QuadPart > 0 && sz.QuadPart < ((LONGLONG)1 << 31)
+        && (*map = CreateFileMappingW(f, NULL, PAGE_READONLY, 0, 0, NULL)) != NULL) {
+        view  = MapViewOfFile(*map, FILE_MAP_READ, 0, 0, 0);
+        *size = (size_t)sz.QuadPart;
+        if (!view) { CloseHandle(*map); *map = NULL; }
+    }
+    CloseHandle(f);
+    return view;
+}
+
+static void unmap_file(HANDLE map, const void *view) {
+    if (view) UnmapViewOfFile(view);
+    if (map)  CloseHandle(map);
+}
+
+/* "<exe folder>\lang\<file>" (çalıştırılabilir dosyanın yanındaki lang klasörü) */
+static void pack_path(wchar_t *out, const wchar_t *file) {
+    wchar_t dir[MAX_PATH];
+    DWORD n = GetModuleFileNameW(NULL, dir, MAX_PATH);
+    while (n > 0 && dir[n - 1] != L'\\' && dir[n - 1] != L'/') n--;
+    dir[n] = 0;
+    swprintf(out, MAX_PATH, L"%lslang\\%ls", dir, file);
+}
 
-static const wchar_t *S(const wchar_t *key) {
-    for (int i = 0; str_table[i].key; i++)
-        if (wcscmp(str_table[i].key, key) == 0)
-            return lang == 0 ? str_table[i].tr : str_table[i].en;
-    return key;
+/* Switch to built-in l, or to pack `file` when l == 2; a pack that fails
+   to load leaves English (dili değiştir; yüklenemeyen paket İngilizce bırakır) */
+static void set_language(int l, const wchar_t *file) {
+    HANDLE map = NULL;
+    const void *view = NULL;
+    LangPack pack;
+    if (l == 2) {
+        wchar_t path[MAX_PATH];
+        size_t size = 0;
+        pack_path(path, file);
+        view = map_file(path, &map, &size);
+        if (!view || !lang_parse(&pack, view, size)) { unmap_file(map, view); view = NULL; map = NULL; l = 1; }
+    }
+    for (int id = 0; id < STR_COUNT; id++)
+        g_str[id] = l == 0 ? str_tr[id]
+                  : l == 1 || !pack.str[id] ? str_en[id]
+                  : (const wchar_t *)pack.str[id];
+    unmap_file(g_pack_map, g_pack_view);      /* after the table stopped pointing into it (tablo bıraktıktan sonra) */
+    g_pack_map  = map;
+    g_pack_view = view;
+    if (l == 2 && file != g_pack_file) wcsncpy(g_pack_file, file, MAX_PATH - 1);
+    lang = l;
 }
 
 /* ── Registry persistence (Kayıt defteri kalıcılığı) ─────────────────── */
@@ -83,9 +173,12 @@ static void save_settings(void) {
                         KEY_WRITE, NULL, &hk, NULL) != ERROR_SUCCESS) return;
     DWORD v;
     v = (DWORD)lang;  RegSetValueExW(hk, L"Language", 0, REG_DWORD, (BYTE*)&v, sizeof v);
+    RegSetValueExW(hk, L"LanguagePack", 0, REG_SZ, (const BYTE*)g_pack_file,
+                   (DWORD)((wcslen(g_pack_file) + 1) * sizeof(wchar_t)));
     v = (DWORD)ROWS;  RegSetValueExW(hk, L"Rows",     0, REG_DWORD, (BYTE*)&v, sizeof v);
     v = (DWORD)COLS;  RegSetValueExW(hk, L"Cols",     0, REG_DWORD, (BYTE*)&v, sizeof v);
     v = (DWORD)MINES; RegSetValueExW(hk, L"Mines",    0, REG_DWORD, (BYTE*)&v, sizeof v);
+    v = (DWORD)no_guess; RegSetValueExW(hk, L"NoGuess", 0, REG_DWORD, (BYTE*)&v, sizeof v);
     RegCloseKey(hk);
 }
 
@@ -93,8 +186,12 @@ static void load_settings(void) {
     HKEY hk;
     if (RegOpenKeyExW(HKEY_CURRENT_USER, REG_KEY, 0, KEY_READ, &hk) != ERROR_SUCCESS) return;
     DWORD v, sz = sizeof v;
-    if (RegQueryValueExW(hk, L"Language", NULL, NULL, (BYTE*)&v, &sz) == ERROR_SUCCESS && v <= 1)
+    if (RegQueryValueExW(hk, L"Language", NULL, NULL, (BYTE*)&v, &sz) == ERROR_SUCCESS && v <= 2)
         lang = (int)v;
+    sz = sizeof g_pack_file - sizeof(wchar_t);
+    if (RegQueryValueExW(hk, L"LanguagePack", NULL, NULL, (BYTE*)g_pack_file, &sz) != ERROR_SUCCESS)
+        g_pack_file[0] = 0;
+    g_pack_file[MAX_PATH - 1] = 0;
     sz = sizeof v;
     if (RegQueryValueExW(hk, L"Rows", NULL, NULL, (BYTE*)&v, &sz) == ERROR_SUCCESS
         && v >= 1 && v <= MAX_ROWS) ROWS = (int)v;
@@ -104,202 +201,1091 @@ static void load_settings(void) {
     sz = sizeof v;
     if (RegQueryValueExW(hk, L"Mines", NULL, NULL, (BYTE*)&v, &sz) == ERROR_SUCCESS
         && (int)v >= 1 && (int)v < ROWS * COLS) MINES = (int)v;
+    sz = sizeof v;
+    if (RegQueryValueExW(hk, L"NoGuess", NULL, NULL, (BYTE*)&v, &sz) == ERROR_SUCCESS)
+        no_guess = v != 0;
     RegCloseKey(hk);
 }
 
+/* ── Performance probes (Performans ölçümü) ──────────────────────────── */
+/*
+ * Build with -DMINES_PERF to log startup and resize timings together with
+ * the process GDI/USER handle counts to the debugger output.
+ * Build with -DMINES_TRACE (and trace.c) to record the TRACE_* probes —
+ * message dispatch, clicks, painting, layout and dealing, including the
+ * no-guess workers — and write them at exit to
+ * %APPDATA%\MinesGame\trace.json for chrome://tracing.
+ * (-DMINES_PERF ile açılış/yeniden boyutlandırma süreleri ve tutamak
+ *  sayıları hata ayıklayıcı çıktısına yazılır. -DMINES_TRACE ile izleme
+ *  sondaları kaydedilir ve çıkışta trace.json dosyasına yazılır.)
+ */
+/* Microseconds for the always-on counters (sayaçlar için mikrosaniye) */
+static uint64_t now_us(void) {
+    LARGE_INTEGER f, t;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&t);
+    return (uint64_t)(t.QuadPart / f.QuadPart * 1000000 + t.QuadPart % f.QuadPart * 1000000 / f.QuadPart);
+}
+
+#ifdef MINES_PERF
+static double perf_ms(void) {
+    LARGE_INTEGER f, t;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&t);
+    return (double)t.QuadPart * 1000.0 / (double)f.QuadPart;
+}
+
+static void perf_log(const wchar_t *what, double ms) {
+    HANDLE p = GetCurrentProcess();
+    wchar_t buf[128];
+    swprintf(buf, 128, L"mines: %ls %.3f ms, GDI %lu, USER %lu\n", what, ms,
+             GetGuiResources(p, GR_GDIOBJECTS), GetGuiResources(p, GR_USEROBJECTS));
+    OutputDebugStringW(buf);
+}
+#endif
+
 /* ── Forward declarations (İleri bildirimler) ────────────────────────── */
-LRESULT CALLBACK ButtonProc(HWND, UINT, WPARAM, LPARAM);
+LRESULT CALLBACK GridProc(HWND, UINT, WPARAM, LPARAM);
+/* A decimal field within lo … hi; false if it is empty, not a number,
+   too long for the buffer or out of range (lo … hi aralığında ondalık alan) */
+static bool read_field(HWND hwnd, int id, long long lo, long long hi, int *out) {
+    wchar_t buf[16], *end;
+    int n = GetDlgItemTextW(hwnd, id, buf, 16);
+    if (n <= 0 || n >= 15) return false;            /* 15 digits are out of range anyway (zaten aralık dışı) */
+    long long v = wcstoll(buf, &end, 10);
+    if (*end != L'\0' || v < lo || v > hi) return false;
+    *out = (int)v;
+    return true;
+}
+
 LRESULT CALLBACK SettingsDlgProc(HWND, UINT, WPARAM, LPARAM);
-void rebuild_buttons(void);
 void relayout(int clientW, int clientH);
 void update_menu(void);
 void init_game(void);
 void reveal_cell(int r, int c);
 static HMENU create_menu(void);
 
-/* ── Helper: grid index from control ID (kimlikten ızgara indeksi) ───── */
-static void idx_from_id(int id, int *r, int *c) {
-    int idx = id - BASE_ID;
-    *r = idx / COLS;
-    *c = idx % COLS;
-}
-
-/* ── Mine placement & neighbor count (Mayın yerleştirme ve komşu sayısı) */
-static void place_mines_randomly(void) {
-    for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++)
-            mines_grid[r][c] = false;
-    int placed = 0;
-    while (placed < MINES) {
-        int r = rand() % ROWS, c = rand() % COLS;
-        if (!mines_grid[r][c]) { mines_grid[r][c] = true; placed++; }
+/* ── Grid renderer (Izgara çizici) ───────────────────────────────────── */
+/*
+ * The board is shown through a single child window, a viewport no larger
+ * than the client area. The view is the board pixel at the viewport's
+ * top-left plus the cell size; the back buffer holds only the viewport,
+ * cells outside it are never painted, and mouse input is hit-tested
+ * through the same transform. Panning shifts the buffer in place and
+ * paints the cells that came into view, so a frame costs the viewport's
+ * size whatever the board's. WM_PAINT only copies the invalidated part of
+ * the buffer to the screen.
+ *
+ * (Tahta tek bir alt pencereden, istemci alanından büyük olmayan bir
+ *  görüş alanından gösterilir. Arka tampon yalnızca görüş alanını tutar;
+ *  dışındaki hücreler çizilmez, fare aynı dönüşümle hücreye çevrilir.
+ *  Kaydırma tamponu yerinde öteler ve yalnızca görünür hale gelen
+ *  hücreleri çizer; kare maliyeti tahtaya değil görüş alanına bağlıdır.)
+ */
+static HDC     grid_dc;                       /* back buffer, viewport-sized (arka tampon, görüş alanı boyutunda) */
+static HBITMAP grid_bmp, grid_old_bmp;
+static int     grid_w, grid_h;
+static int     view_x, view_y;                /* board pixel at the viewport's top-left (görüş alanının sol üstü) */
+static bool    g_zoomed = false;              /* cell size chosen by the user, not fitted (kullanıcı yakınlaştırdı) */
+static bool    drag_on = false;               /* middle-button pan in progress (orta tuşla kaydırma) */
+static int     drag_x, drag_y;
+static int     press_r = -1, press_c = -1;    /* cell under a held left button (basılı hücre) */
+static bool    press_in = false;              /* pointer still over that cell (imleç hücrede mi) */
+
+/*
+ * Tile atlas: every look a cell can have, pre-rendered once per cell size
+ * into one strip bitmap — hidden raised/pressed, each blank, flagged or
+ * showing its mine, then opened 0–8 and the exploded mine. Painting a cell
+ * is a single BitBlt chosen from game state. Tiles include the 1-px black
+ * gap, and the digit font scales with the cell.
+ * (Döşeme atlası: bir hücrenin her görünümü, hücre boyutu başına bir kez
+ *  tek şerit bitmap'e çizilir. Hücre boyamak tek BitBlt'tir; rakam yazı
+ *  tipi hücreyle ölçeklenir.)
+ */
+enum {
+    TILE_HIDDEN,              /* + TILE_PRESSED, + TILE_FLAG / TILE_SHOWN (gizli) */
+    TILE_FLAG    = 1,
+    TILE_SHOWN   = 2,         /* unopened mine shown after a loss (kayıptan sonra gösterilen mayın) */
+    TILE_PRESSED = 3,
+    TILE_OPEN    = 6,         /* + 0 … 8 (açık) */
+    TILE_BOOM    = TILE_OPEN + 9,
+    TILE_COUNT
+};
+
+static HDC     tile_dc;
+static HBITMAP tile_bmp, tile_old_bmp;
+static int     tile_cs;                       /* cell size the atlas was drawn for (atlasın hücre boyutu) */
+
+static void free_tiles(void) {
+    if (!tile_dc) return;
+    SelectObject(tile_dc, tile_old_bmp);
+    DeleteObject(tile_bmp);
+    DeleteDC(tile_dc);
+    tile_dc = NULL; tile_bmp = NULL;
+    tile_cs = 0;
+}
+
+static void draw_tile(HDC dc, int t, int cs, HFONT font) {
+    /* Classic Minesweeper digit colors (klasik sayı renkleri) */
+    static const COLORREF numColors[] = {
+        0,
+        RGB(0,   0, 200),  /* 1 – blue (mavi) */
+        RGB(0, 130,   0),  /* 2 – green (yeşil) */
+        RGB(200,  0,   0), /* 3 – red (kırmızı) */
+        RGB(0,   0, 130),  /* 4 – dark blue (koyu mavi) */
+        RGB(130,  0,   0), /* 5 – dark red (koyu kırmızı) */
+        RGB(0,  130, 130), /* 6 – teal (camgöbeği) */
+        RGB(80,  80,  80), /* 7 – dark grey (koyu gri) */
+        RGB(80,  80,  80), /* 8 – dark grey (koyu gri) */
+    };
+    int x = t * cs;
+    RECT all = {x, 0, x + cs, cs};
+    RECT rc  = {x, 0, x + cs - 1, cs - 1};   /* 1-px gap (1 piksel boşluk) */
+    FillRect(dc, &all, (HBRUSH)GetStockObject(BLACK_BRUSH));
+
+    bool rev = t >= TILE_OPEN;
+    HBRUSH br = CreateSolidBrush(rev ? RGB(192,192,192) : RGB(220,220,220));
+    FillRect(dc, &rc, br);
+    DeleteObject(br);
+    DrawEdge(dc, &rc, !rev && t >= TILE_PRESSED ? BDR_SUNKENINNER : BDR_RAISEDINNER, BF_RECT);
+
+    wchar_t buf[4] = L"";
+    COLORREF col = RGB(60, 60, 60);           /* mine (mayın) */
+    if (t == TILE_BOOM || (!rev && (t - TILE_HIDDEN) % TILE_PRESSED == TILE_SHOWN)) {
+        wcscpy(buf, L"*");
+    } else if (!rev && (t - TILE_HIDDEN) % TILE_PRESSED == TILE_FLAG) {
+        wcscpy(buf, L"F");
+        col = RGB(200, 0, 0);                 /* flag: red (bayrak: kırmızı) */
+    } else if (rev && t - TILE_OPEN > 0) {
+        swprintf(buf, 4, L"%d", t - TILE_OPEN);
+        col = numColors[t - TILE_OPEN];
+    }
+    if (buf[0] == L'\0') return;
+    SetBkMode(dc, TRANSPARENT);
+    SetTextColor(dc, col);
+    HFONT old = (HFONT)SelectObject(dc, font);
+    DrawTextW(dc, buf, -1, &rc, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+    SelectObject(dc, old);
+}
+
+/* (Re)draw the atlas for cell size cs; false on GDI failure (atlası çiz) */
+static bool build_tiles(int cs) {
+    free_tiles();
+    HDC screen = GetDC(gridWnd);
+    tile_dc  = CreateCompatibleDC(screen);
+    tile_bmp = tile_dc ? CreateCompatibleBitmap(screen, TILE_COUNT * cs, cs) : NULL;
+    ReleaseDC(gridWnd, screen);
+    if (!tile_bmp) { if (tile_dc) DeleteDC(tile_dc); tile_dc = NULL; return false; }
+    tile_old_bmp = (HBITMAP)SelectObject(tile_dc, tile_bmp);
+
+    HFONT font = CreateFontW(-(cs * 3 / 5), 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE, DEFAULT_CHARSET,
+                             OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS, CLEARTYPE_QUALITY,
+                             DEFAULT_PITCH | FF_SWISS, L"Segoe UI");
+    HFONT use  = font ? font : (HFONT)GetStockObject(DEFAULT_GUI_FONT);
+    for (int t = 0; t < TILE_COUNT; t++) draw_tile(tile_dc, t, cs, use);
+    if (font) DeleteObject(font);
+    tile_cs = cs;
+    return true;
+}
+
+/* The tile for (r, c) from game state alone (hücrenin döşemesi) */
+static int cell_tile(int r, int c) {
+    uint8_t v = board_cell(&board, r, c);
+    if (v & CELL_REVEALED) return (v & CELL_MINE) ? TILE_BOOM : TILE_OPEN + (v & CELL_COUNT);
+    int t = (press_in && r == press_r && c == press_c) ? TILE_PRESSED : TILE_HIDDEN;
+    if ((v & CELL_MINE) && g_show_mines) return t + TILE_SHOWN;
+    if (v & CELL_FLAGGED)                return t + TILE_FLAG;
+    return t;
+}
+
+/* Cells outside the viewport are skipped (görüş alanı dışı atlanır) */
+static void paint_cell(int r, int c) {
+    if (!grid_dc) return;
+    int cs = cell_size;
+    int x = c * cs - view_x, y = r * cs - view_y;
+    if (x <= -cs || y <= -cs || x >= grid_w || y >= grid_h) return;
+    if (tile_cs != cs && !build_tiles(cs)) return;
+    BitBlt(grid_dc, x, y, cs, cs, tile_dc, cell_tile(r, c) * cs, 0, SRCCOPY);
+    stats_painted(&g_stats, 1, GetTickCount64());
+}
+
+/* Paint every cell touching viewport pixels [x0, x1) × [y0, y1)
+   (görüş alanı dikdörtgenine değen hücreleri çiz) */
+static void paint_area(int x0, int y0, int x1, int y1) {
+    int cs = cell_size;
+    int r1 = (view_y + y1 - 1) / cs, c1 = (view_x + x1 - 1) / cs;
+    if (r1 >= ROWS) r1 = ROWS - 1;
+    if (c1 >= COLS) c1 = COLS - 1;
+    for (int r = (view_y + y0) / cs; r <= r1; r++)
+        for (int c = (view_x + x0) / cs; c <= c1; c++)
+            paint_cell(r, c);
+}
+
+/* Redraw one cell into the buffer and queue it for the screen (tek hücreyi yenile) */
+static void refresh_cell(int r, int c) {
+    paint_cell(r, c);
+    int cs = cell_size;
+    RECT rc = {c * cs - view_x, r * cs - view_y, c * cs + cs - view_x, r * cs + cs - view_y};
+    InvalidateRect(gridWnd, &rc, FALSE);
+    g_stats.game.invalidations++;
+}
+
+static void refresh_grid(void) {
+    if (!grid_dc) return;
+    RECT all = {0, 0, grid_w, grid_h};
+    FillRect(grid_dc, &all, (HBRUSH)GetStockObject(BLACK_BRUSH));
+    paint_area(0, 0, grid_w, grid_h);
+    InvalidateRect(gridWnd, NULL, FALSE);
+    g_stats.game.invalidations++;
+}
+
+/* Keep the viewport inside the board (görüş alanını tahtanın içinde tut) */
+static void clamp_view(void) {
+    int max_x = COLS * cell_size - grid_w, max_y = ROWS * cell_size - grid_h;
+    if (view_x > max_x) view_x = max_x;
+    if (view_y > max_y) view_y = max_y;
+    if (view_x < 0) view_x = 0;
+    if (view_y < 0) view_y = 0;
+}
+
+/* Move the view to board pixel (x, y), clamped to the board: the buffer
+   is shifted in place and only the strips that came into view are
+   painted (görünümü kaydır; yalnızca yeni görünen şeritler çizilir) */
+static void scroll_view(int x, int y) {
+    int old_x = view_x, old_y = view_y;
+    view_x = x; view_y = y;
+    clamp_view();
+    int dx = view_x - old_x, dy = view_y - old_y;
+    if ((!dx && !dy) || !grid_dc) return;
+    TRACE_BEGIN("scroll_view");
+    if (abs(dx) >= grid_w || abs(dy) >= grid_h) {
+        refresh_grid();
+    } else {
+        BitBlt(grid_dc, dx < 0 ? -dx : 0, dy < 0 ? -dy : 0, grid_w - abs(dx), grid_h - abs(dy),
+               grid_dc, dx > 0 ? dx : 0, dy > 0 ? dy : 0, SRCCOPY);
+        if (dx > 0) paint_area(grid_w - dx, 0, grid_w, grid_h);
+        if (dx < 0) paint_area(0, 0, -dx, grid_h);
+        if (dy > 0) paint_area(0, grid_h - dy, grid_w, grid_h);
+        if (dy < 0) paint_area(0, 0, grid_w, -dy);
+        InvalidateRect(gridWnd, NULL, FALSE);
+        g_stats.game.invalidations++;
     }
+    TRACE_END("scroll_view");
 }
 
-static void compute_neighbors(void) {
-    for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++) {
-            if (mines_grid[r][c]) { neigh[r][c] = -1; continue; }
-            int cnt = 0;
-            for (int dr = -1; dr <= 1; dr++)
-                for (int dc = -1; dc <= 1; dc++) {
-                    if (!dr && !dc) continue;
-                    int rr = r+dr, cc = c+dc;
-                    if (rr >= 0 && rr < ROWS && cc >= 0 && cc < COLS && mines_grid[rr][cc]) cnt++;
-                }
-            neigh[r][c] = cnt;
+/*
+ * Apply one action's change-set: repaint each changed cell into the back
+ * buffer, then invalidate per-row spans, with consecutive rows sharing a
+ * span merged into one rectangle. An opening is a blob, so that is usually
+ * a handful of rectangles; past MAX_RECTS the bounding box is used instead.
+ * (Eylemin değişiklik kümesini uygula: hücreleri tampona çiz, sonra satır
+ *  aralıklarını birleştirerek az sayıda dikdörtgeni geçersiz kıl.)
+ */
+#define MAX_RECTS 16
+
+static void apply_changes(ChangeSet *cs) {
+    if (cs->oom) { refresh_grid(); changes_clear(cs); return; }
+    if (!cs->n || !grid_dc) { changes_clear(cs); return; }
+    int cs_px = cell_size, rows = cs->r1 - cs->r0 + 1;
+    RECT box = {cs->c0 * cs_px - view_x, cs->r0 * cs_px - view_y,
+                (cs->c1 + 1) * cs_px - view_x, (cs->r1 + 1) * cs_px - view_y};
+    if (box.right <= 0 || box.bottom <= 0 || box.left >= grid_w || box.top >= grid_h) {
+        changes_clear(cs);                      /* all out of view (tümü görüş dışında) */
+        return;
+    }
+    TRACE_BEGIN_ARG("apply_changes", cs->n);
+    for (size_t i = 0; i < cs->n; i++) paint_cell(cs->cells[i].r, cs->cells[i].c);
+
+    int *span = malloc((size_t)rows * 2 * sizeof *span);    /* lo, hi per row (satır başına aralık) */
+    RECT rects[MAX_RECTS];
+    int n = span ? 0 : MAX_RECTS + 1;
+    if (span) {
+        for (int i = 0; i < rows; i++) { span[2 * i] = COLS; span[2 * i + 1] = -1; }
+        for (size_t i = 0; i < cs->n; i++) {
+            int *s = &span[2 * (cs->cells[i].r - cs->r0)], c = cs->cells[i].c;
+            if (c < s[0]) s[0] = c;
+            if (c > s[1]) s[1] = c;
         }
+        for (int i = 0; i < rows && n <= MAX_RECTS; ) {
+            int j = i + 1;
+            if (span[2 * i + 1] < 0) { i = j; continue; }
+            while (j < rows && span[2 * j] == span[2 * i] && span[2 * j + 1] == span[2 * i + 1]) j++;
+            if (n < MAX_RECTS)
+                rects[n] = (RECT){span[2 * i] * cs_px - view_x, (cs->r0 + i) * cs_px - view_y,
+                                  (span[2 * i + 1] + 1) * cs_px - view_x, (cs->r0 + j) * cs_px - view_y};
+            n++;
+            i = j;
+        }
+        free(span);
+    }
+    if (n > MAX_RECTS) InvalidateRect(gridWnd, &box, FALSE);
+    else for (int i = 0; i < n; i++) InvalidateRect(gridWnd, &rects[i], FALSE);
+    g_stats.game.invalidations += n > MAX_RECTS ? 1 : (uint64_t)n;
+    changes_clear(cs);
+    TRACE_END("apply_changes");
+}
+
+static void free_back_buffer(void) {
+    if (!grid_dc) return;
+    SelectObject(grid_dc, grid_old_bmp);
+    DeleteObject(grid_bmp);
+    DeleteDC(grid_dc);
+    grid_dc = NULL; grid_bmp = NULL;
+    grid_w = grid_h = 0;
+}
+
+/* (Re)create the back buffer for the current grid size (arka tamponu oluştur) */
+static void resize_back_buffer(int w, int h) {
+    free_back_buffer();
+    HDC screen = GetDC(gridWnd);
+    grid_dc  = CreateCompatibleDC(screen);
+    grid_bmp = CreateCompatibleBitmap(screen, w, h);
+    ReleaseDC(gridWnd, screen);
+    grid_old_bmp = (HBITMAP)SelectObject(grid_dc, grid_bmp);
+    grid_w = w; grid_h = h;
+    clamp_view();
+    refresh_grid();
+}
+
+static bool hit_test(LPARAM lParam, int *r, int *c) {
+    int x = GET_X_LPARAM(lParam), y = GET_Y_LPARAM(lParam);
+    if (x < 0 || y < 0 || x >= grid_w || y >= grid_h) return false;
+    *r = (y + view_y) / cell_size;
+    *c = (x + view_x) / cell_size;
+    return *r < ROWS && *c < COLS;
+}
+
+static LRESULT grid_proc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+    int r, c;
+    switch (msg) {
+    case WM_ERASEBKGND:
+        return 1;   /* everything comes from the back buffer (her şey arka tampondan) */
+
+    case WM_PAINT: {
+        PAINTSTRUCT ps;
+        TRACE_BEGIN("WM_PAINT");
+        HDC dc = BeginPaint(hwnd, &ps);
+        RECT *u = &ps.rcPaint;
+        if (grid_dc)
+            BitBlt(dc, u->left, u->top, u->right - u->left, u->bottom - u->top,
+                   grid_dc, u->left, u->top, SRCCOPY);
+        EndPaint(hwnd, &ps);
+        g_stats.game.paints++;
+        TRACE_END("WM_PAINT");
+        return 0;
+    }
+
+    /* Left button behaves like a push button: press, track, release over the cell
+       (sol tuş buton gibi davranır: bas, izle, hücre üzerinde bırak) */
+    case WM_LBUTTONDOWN:
+        if (!g_game_over && hit_test(lParam, &r, &c) && !board_revealed(&board, r, c)) {
+            press_r = r; press_c = c; press_in = true;
+            SetCapture(hwnd);
+            refresh_cell(r, c);
+        }
+        return 0;
+
+    /* Middle button drags the view (orta tuş görünümü sürükler) */
+    case WM_MBUTTONDOWN:
+        drag_on = true;
+        drag_x = GET_X_LPARAM(lParam); drag_y = GET_Y_LPARAM(lParam);
+        SetCapture(hwnd);
+        return 0;
+
+    case WM_MBUTTONUP:
+        if (drag_on) ReleaseCapture();
+        return 0;
+
+    case WM_MOUSEMOVE:
+        if (drag_on) {
+            int x = GET_X_LPARAM(lParam), y = GET_Y_LPARAM(lParam);
+            scroll_view(view_x - (x - drag_x), view_y - (y - drag_y));
+            drag_x = x; drag_y = y;
+        }
+        if (press_r >= 0) {
+            bool in = hit_test(lParam, &r, &c) && r == press_r && c == press_c;
+            if (in != press_in) { press_in = in; refresh_cell(press_r, press_c); }
+        }
+        return 0;
+
+    case WM_LBUTTONUP:
+        if (press_r >= 0) {
+            bool click = press_in;
+            r = press_r; c = press_c;
+            ReleaseCapture();                   /* clears the press (basılı durumu temizler) */
+            if (click && !board_flagged(&board, r, c) && !board_revealed(&board, r, c))
+                reveal_cell(r, c);
+        }
+        return 0;
+
+    case WM_CAPTURECHANGED:
+        drag_on = false;
+        if (press_r >= 0) {
+            r = press_r; c = press_c;
+            press_r = press_c = -1; press_in = false;
+            refresh_cell(r, c);
+        }
+        return 0;
+
+    /* Right click toggles a flag (sağ tık bayrağı değiştirir) */
+    case WM_RBUTTONUP:
+        if (!g_game_over && hit_test(lParam, &r, &c) && board_toggle_flag(&board, r, c, &g_changes)) {
+            journal_push(&g_journal, &board, JOURNAL_FLAG, &g_changes);
+            replay_record(&g_replay, REPLAY_FLAG, r, c, GetTickCount64() - g_game_t0);
+            apply_changes(&g_changes);
+        }
+        return 0;
+
+    case WM_DESTROY:
+        free_back_buffer();
+        free_tiles();
+        return 0;
+    }
+    return DefWindowProcW(hwnd, msg, wParam, lParam);
+}
+
+/* Message dispatch is traced with the message number as its argument
+   (ileti dağıtımı ileti numarasıyla izlenir) */
+LRESULT CALLBACK GridProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+    TRACE_BEGIN_ARG("GridProc", msg);
+    LRESULT res = grid_proc(hwnd, msg, wParam, lParam);
+    TRACE_END("GridProc");
+    return res;
+}
+
+/* ── Files under %APPDATA% (Uygulama verisi dosyaları) ───────────────── */
+/* "%APPDATA%\MinesGame\<name>", creating the folder; false without
+   APPDATA (uygulama verisi klasöründeki yol) */
+static bool app_path(wchar_t *out, const wchar_t *name) {
+    DWORD n = GetEnvironmentVariableW(L"APPDATA", out, MAX_PATH);
+    if (n == 0 || n + 12 + wcslen(name) >= MAX_PATH) return false;
+    wcscpy(out + n, L"\\MinesGame");
+    CreateDirectoryW(out, NULL);
+    n = (DWORD)wcslen(out);
+    swprintf(out + n, MAX_PATH - n, L"\\%ls", name);
+    return true;
+}
+
+/*
+ * Files are written by one background thread: the image is handed over,
+ * written to "<path>.tmp" and renamed over <path>, so closing the window
+ * or starting a game never waits on the disk and a crash mid-write never
+ * leaves a torn file. A new write waits only for the previous one.
+ * (Dosyaları arka plan iş parçacığı yazar: önce .tmp, sonra yeniden
+ *  adlandırma; arayüz diski beklemez.)
+ */
+typedef struct {
+    wchar_t  path[MAX_PATH];
+    uint8_t *data;
+    size_t   len;
+    Replay   replay;          /* encoded into data first when ev is set (önce kodlanacak kayıt) */
+    Board    board;           /* when set, snapshotted with replay as its log (anlık görüntüsü alınacak tahta) */
+    SnapInfo snap;
+} WriteJob;
+
+static WriteJob g_job;
+static Thread   g_writer;
+static bool     g_writer_busy;
+
+static void write_file(WriteJob *job) {
+    if (job->board.rows) {
+        size_t log_len = 0;
+        uint8_t *log = replay_encode(&job->replay, SIZE_MAX, &log_len);
+        job->snap.extra     = log;
+        job->snap.extra_len = log ? log_len : 0;
+        job->data = snapshot_encode(&job->board, &job->snap, &job->len);
+        free(log);
+        replay_free(&job->replay);
+        board_free(&job->board);
+        if (!job->data) return;
+    } else if (job->replay.ev) {
+        job->data = replay_encode(&job->replay, 0, &job->len);
+        replay_free(&job->replay);
+        if (!job->data) return;
+    }
+    wchar_t tmp[MAX_PATH + 4];
+    swprintf(tmp, MAX_PATH + 4, L"%ls.tmp", job->path);
+    HANDLE f = CreateFileW(tmp, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (f != INVALID_HANDLE_VALUE) {
+        DWORD written;
+        BOOL ok = WriteFile(f, job->data, (DWORD)job->len, &written, NULL) && written == job->len;
+        CloseHandle(f);
+        if (!ok || !MoveFileExW(tmp, job->path, MOVEFILE_REPLACE_EXISTING)) DeleteFileW(tmp);
+    }
+    free(job->data);
+    job->data = NULL;
+}
+
+static THREAD_RET writer_main(void *arg) {
+    write_file(arg);
+    return 0;
+}
+
+static void writer_wait(void) {
+    if (g_writer_busy) thread_join(g_writer);
+    g_writer_busy = false;
+}
+
+static void writer_run(void) {
+    if (thread_start(&g_writer, writer_main, &g_job)) g_writer_busy = true;
+    else write_file(&g_job);
+}
+
+/* Write and free `data` in the background (arka planda yaz ve serbest bırak) */
+static void write_async(const wchar_t *path, uint8_t *data, size_t len) {
+    writer_wait();
+    wcsncpy(g_job.path, path, MAX_PATH - 1);
+    g_job.data = data;
+    g_job.len  = len;
+    writer_run();
+}
+
+/* Encode a copy of the replay and write it in the background; the game
+   keeps recording into rp (kaydın kopyasını arka planda kodla ve yaz) */
+static void write_replay_async(const wchar_t *path, const Replay *rp) {
+    writer_wait();
+    if (!replay_copy(&g_job.replay, rp)) return;
+    wcsncpy(g_job.path, path, MAX_PATH - 1);
+    g_job.data = NULL;
+    writer_run();
+}
+
+/* Snapshot b, with the log in rp, in the background; both are moved to
+   the writer and left empty, so the chunks are never copied here
+   (tahta ve kayıt yazıcıya taşınır, anlık görüntü arka planda alınır) */
+static void write_snapshot_async(const wchar_t *path, Board *b, Replay *rp, SnapInfo info) {
+    writer_wait();
+    wcsncpy(g_job.path, path, MAX_PATH - 1);
+    g_job.data   = NULL;
+    g_job.board  = *b;
+    g_job.replay = *rp;
+    g_job.snap   = info;
+    *b  = (Board){0};
+    *rp = (Replay){0};
+    writer_run();
+}
+
+/* ── Replays (Tekrar kayıtları) ──────────────────────────────────────── */
+/* Keyframes are built once the game is over, on the writer thread from a
+   copy of the event log, so neither a click nor the last one does more
+   than append to it. Files go to %APPDATA%\MinesGame\replays and are
+   checked with "bench replay <file>".
+   (Ana kareler oyun bitince, yazıcı iş parçacığında kaydın kopyasından
+    üretilir; son tıklama bile yalnızca kayda ekler.) */
+static void save_replay(void) {
+    replay_finish(&g_replay, &board);
+    wchar_t path[MAX_PATH];
+    if (!app_path(path, L"replays")) return;
+    CreateDirectoryW(path, NULL);
+    size_t n = wcslen(path);
+    if (n + 40 >= MAX_PATH) return;
+    swprintf(path + n, MAX_PATH - n, L"\\%016llX-%llu.mrp",
+             (unsigned long long)board.seed, (unsigned long long)time(NULL));
+    write_replay_async(path, &g_replay);
+}
+
+/* A lost game may still be taken back, so its replay is saved only when
+   the player moves on — the next game or exit — or wins it after all.
+   A game abandoned for a new one (`leaving`) is saved unfinished; one
+   open at exit goes into the snapshot instead and is saved when it ends
+   (kaybedilen oyunun kaydı sonraki oyunda, çıkışta ya da kazanınca
+   yazılır; yarım bırakılan oyun yeni oyunda yarım olarak yazılır) */
+static void settle_replay(bool leaving) {
+    if (leaving && !g_game_over && !g_deal_pending && g_replay.n_events) g_replay_pending = true;
+    if (!g_replay_pending) return;
+    g_replay_pending = false;
+    save_replay();
 }
 
 /* ── Game init (Oyun başlatma) ───────────────────────────────────────── */
+/* A fresh seed from the clock and the performance counter (saatten yeni tohum) */
+static uint64_t new_seed(void) {
+    static uint64_t calls;
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return rng_mix((uint64_t)t.QuadPart ^ ((uint64_t)time(NULL) << 32) ^ rng_mix(++calls));
+}
+
+/* "Mines — seed 0123456789ABCDEF": the title is enough to replay a board
+   (başlıktaki tohum tahtayı yeniden üretmeye yeter) */
+static void update_title(void) {
+    wchar_t buf[64];
+    swprintf(buf, 64, L"Mines — %ls %016llX", S(STR_SEED), (unsigned long long)board.seed);
+    SetWindowTextW(mainWindow, buf);
+}
+
+/* Index the openings of a freshly dealt board; boards that reveal in
+   parallel skip it, as the labels alone would take 4 bytes per cell
+   (yeni dağıtılan tahtanın açıklıklarını dizinle) */
+static void index_openings(void) {
+    TRACE_BEGIN("index_openings");
+    if ((size_t)ROWS * COLS >= PARALLEL_REVEAL_CELLS || !openings_build(&g_openings, &board))
+        openings_clear(&g_openings);
+    TRACE_END("index_openings");
+}
+
+/* Grade a board dealt on this thread for the win dialog, so winning only
+   formats it; pooled boards come graded by the worker
+   (bu iş parçacığında dağıtılan tahtayı derecelendir) */
+static void grade_deal(void) {
+    Grader g = {0};
+    Grade  grade;
+    TRACE_BEGIN("grade");
+    g_bv = grade_board(&g, &board, 0, &grade) ? grade.value[GRADE_3BV] : 0;
+    TRACE_END("grade");
+    grade_free(&g);
+}
+
+/* Point the pool at the current settings; a change from the settings
+   dialog or the no-guess toggle drops the boards dealt for the old ones.
+   No-guess boards are dealt at the first click, so none are kept for them
+   (havuzu geçerli ayarlara yönelt; tahminsiz tahtalar önceden dağıtılmaz) */
+static void want_boards(void) {
+    if (no_guess && (size_t)ROWS * COLS <= NOGUESS_MAX_CELLS) pool_want(&g_pool, 0, 0, 0);
+    else                                                       pool_want(&g_pool, ROWS, COLS, MINES);
+}
+
 void init_game(void) {
-    revealedCount = 0;
-    g_game_over   = false;
-    for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++) {
-            revealed[r][c] = false;
-            flagged [r][c] = false;
-            if (buttons[r][c]) {
-                SetWindowTextW(buttons[r][c], L"");
-                EnableWindow(buttons[r][c], TRUE);
-                InvalidateRect(buttons[r][c], NULL, TRUE);
-            }
+    TRACE_BEGIN("init_game");
+    settle_replay(true);
+    stats_new_game(&g_stats, GetTickCount64());
+    g_game_over  = false;
+    g_show_mines = false;
+    journal_clear(&g_journal);
+    g_index_lazy = false;
+    want_boards();
+    g_deal_pending = no_guess && (size_t)ROWS * COLS <= NOGUESS_MAX_CELLS;
+    g_deal_direct  = g_seed_set;
+
+    /* A ready board is a swap; a typed-in seed is always dealt here
+       (hazır tahta bir takastır; girilen tohum burada dağıtılır) */
+    uint64_t t0 = now_us();
+    bool pooled = !g_deal_pending && !g_seed_set && pool_take(&g_pool, ROWS, COLS, MINES, &board, &g_openings, &g_bv);
+    if (!pooled) {
+        board_setup(&board, ROWS, COLS, MINES);
+        openings_clear(&g_openings);
+        board.seed = g_seed_set ? g_seed_next : new_seed();
+        g_bv = 0;
+    }
+    g_seed_set = false;
+    if (!g_deal_pending) {
+        TRACE_BEGIN("deal");
+        if (!pooled) {
+            board_place_mines(&board);
+            board_compute_neighbors(&board);
+            index_openings();
+            grade_deal();
         }
-    place_mines_randomly();
-    compute_neighbors();
+        g_stats.game.deals++;
+        g_stats.game.pooled += pooled;
+        g_stats.game.deal_us += now_us() - t0;
+        TRACE_END("deal");
+        replay_begin(&g_replay, &board, -1, -1);
+    }
+    g_game_t0 = GetTickCount64();
+    refresh_grid();
+    update_title();
+    TRACE_END("init_game");
+}
+
+/*
+ * A game in progress is saved on exit and resumed on the next launch. The
+ * snapshot holds the board's cells as they are plus the replay log so far
+ * (without keyframes), so the finished game's replay stays complete.
+ * Called once the window is gone: the board and the log are handed to
+ * the writer thread, which encodes them, so exiting never waits on
+ * copying the chunks.
+ * (Süren oyun çıkışta kaydedilir ve sonraki açılışta sürdürülür; tahta
+ *  ve kayıt yazıcı iş parçacığına devredilir.)
+ */
+static void autosave(void) {
+    wchar_t path[MAX_PATH];
+    if (!app_path(path, L"resume.snap")) return;
+    if (g_game_over || g_deal_pending) {            /* nothing to resume (sürdürülecek oyun yok) */
+        writer_wait();
+        DeleteFileW(path);
+        return;
+    }
+    SnapInfo info = { GetTickCount64() - g_game_t0, NULL, 0, g_bv };
+    write_snapshot_async(path, &board, &g_replay, info);
 }
 
+/* Restore the game left open at the last exit; false if there is none.
+   The opening index is not rebuilt here but at the first reveal, so
+   resuming costs the chunk copy alone; that reveal pays the index, up to
+   PARALLEL_REVEAL_CELLS cells' worth (son çıkışta açık kalan oyunu geri
+   yükle; açıklık dizini ilk açmada kurulur) */
+static bool resume_game(void) {
+    wchar_t path[MAX_PATH];
+    HANDLE map = NULL;
+    size_t size = 0;
+    if (!app_path(path, L"resume.snap")) return false;
+    const void *view = map_file(path, &map, &size);
+    SnapInfo info;
+    bool ok = view && snapshot_restore(&board, view, size, &info)
+           && board.rows <= MAX_ROWS && board.cols <= MAX_COLS && !board.exploded && !board_won(&board)
+           && replay_decode(&g_replay, info.extra, info.extra_len) && g_replay.seed == board.seed;
+    unmap_file(map, view);
+    if (!ok) { replay_free(&g_replay); return false; }   /* not a log to save (kaydedilecek kayıt değil) */
+    ROWS  = board.rows;
+    COLS  = board.cols;
+    MINES = board.mines;
+    openings_clear(&g_openings);
+    g_index_lazy = true;
+    g_bv = info.bv;
+    g_game_t0 = GetTickCount64() - info.elapsed_ms;
+    return true;
+}
+
+/* The win dialog shows the board's 3BV — the fewest clicks that clear it,
+   graded when the board was dealt — over the time taken
+   (kazanma penceresi 3BV/sn gösterir) */
 static void check_win(void) {
-    if (revealedCount != ROWS * COLS - MINES) return;
+    if (!board_won(&board)) return;
     g_game_over = true;
-    MessageBoxW(mainWindow, S(L"win_msg"), S(L"win_title"), MB_OK | MB_ICONINFORMATION);
-    for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++)
-            EnableWindow(buttons[r][c], FALSE);
-}
-
-static void reveal_all_mines(void) {
-    for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++)
-            if (mines_grid[r][c]) {
-                SetWindowTextW(buttons[r][c], L"*");
-                EnableWindow(buttons[r][c], FALSE);
-                InvalidateRect(buttons[r][c], NULL, TRUE);
-            }
+    double secs = (double)(GetTickCount64() - g_game_t0) / 1000;
+    g_replay_pending = false;
+    save_replay();
+
+    wchar_t buf[512];
+    if (g_bv)
+        swprintf(buf, 512, L"%ls\n\n3BV: %u\n%ls: %.1f s\n3BV/s: %.2f", S(STR_WIN_MSG), g_bv,
+                 S(STR_WIN_TIME), secs, g_bv / (secs > 0.001 ? secs : 0.001));
+    else
+        swprintf(buf, 512, L"%ls", S(STR_WIN_MSG));
+    MessageBoxW(mainWindow, buf, S(STR_WIN_TITLE), MB_OK | MB_ICONINFORMATION);
 }
 
+/* Show or hide every mine. Tiles are picked from g_show_mines, so the
+   viewport is repainted rather than every mine on the board
+   (tüm mayınları göster ya da gizle; yalnızca görüş alanı çizilir) */
+static void show_mines(bool on) {
+    g_show_mines = on;
+    refresh_grid();
+}
+
+/*
+ * No-guess mode deals on the first click: candidate boards are searched on
+ * every core until one the deduction solver clears from (r, c) turns up.
+ * The title then shows the winning seed; a seed typed into the settings
+ * is dealt as-is around the first click.
+ * (Tahminsiz modda ilk tıklamada dağıtılır: çözücünün (r, c)'den
+ *  temizlediği ilk aday seçilir.)
+ */
+static void deal_no_guess(int r, int c) {
+    g_deal_pending = false;
+    HCURSOR old = SetCursor(LoadCursor(NULL, IDC_WAIT));
+    TRACE_BEGIN("deal_no_guess");
+    uint64_t t_deal = now_us();
+#ifdef MINES_PERF
+    double t0 = perf_ms();
+#endif
+    GenStats st = {0};
+    if (g_deal_direct) {
+        board_place_mines_around(&board, r, c);
+        board_compute_neighbors(&board);
+    } else {
+        generate_no_guess(&board, r, c, 0, NOGUESS_MAX_CANDIDATES, &st);
+    }
+    index_openings();
+    grade_deal();
+    replay_begin(&g_replay, &board, r, c);
+    /* Flags placed while the deal waited go into the new log; on OOM they
+       were taken down, so repaint (bekleyen dağıtımdan önceki bayraklar) */
+    if (!replay_adopt_flags(&g_replay, &board, &g_journal)) refresh_grid();
+    g_stats.game.deals++;
+    g_stats.game.deal_us += now_us() - t_deal;
+    g_stats.game.candidates += st.candidates;
+#ifdef MINES_PERF
+    double ms = perf_ms() - t0;
+    wchar_t buf[128];
+    swprintf(buf, 128, L"mines: no-guess %llu candidates on %d threads, %.0f/s\n",
+             (unsigned long long)st.candidates, st.threads, ms > 0 ? st.candidates * 1000.0 / ms : 0.0);
+    OutputDebugStringW(buf);
+    perf_log(L"no-guess deal", ms);
+#endif
+    TRACE_END("deal_no_guess");
+    SetCursor(old);
+    update_title();
+}
+
+/* One user click: flood-fill in the core, one repaint pass over its
+   change-set, then a single win/lose check
+   (tek tıklama: çekirdekte açma, değişiklik kümesini tek geçişte çizme,
+   ardından tek kazanma/kaybetme kontrolü) */
 void reveal_cell(int r, int c) {
-    if (r < 0 || r >= ROWS || c < 0 || c >= COLS) return;
-    if (revealed[r][c] || flagged[r][c]) return;
-
-    revealed[r][c] = true;
-    revealedCount++;
-    HWND btn = buttons[r][c];
-    EnableWindow(btn, FALSE);
-    InvalidateRect(btn, NULL, TRUE);
-
-    if (mines_grid[r][c]) {
-        SetWindowTextW(btn, L"*");
-        reveal_all_mines();
-        g_game_over = true;
-        MessageBoxW(mainWindow, S(L"lose_msg"), S(L"lose_title"), MB_OK | MB_ICONERROR);
-        for (int i = 0; i < ROWS; i++)
-            for (int j = 0; j < COLS; j++)
-                EnableWindow(buttons[i][j], FALSE);
-        return;
+    TRACE_BEGIN("reveal_cell");
+    if (g_deal_pending) deal_no_guess(r, c);
+    if (g_index_lazy) { g_index_lazy = false; index_openings(); }
+    TRACE_BEGIN("board_reveal");
+    int opened = (size_t)ROWS * COLS >= PARALLEL_REVEAL_CELLS
+               ? board_reveal_parallel(&board, r, c, 0, &g_changes)
+               : openings_reveal(&g_openings, &board, r, c, &g_changes);
+    TRACE_END("board_reveal");
+    if (opened) {
+        stats_reveal(&g_stats, (uint64_t)opened);
+        journal_push(&g_journal, &board, JOURNAL_REVEAL, &g_changes);
+        replay_record(&g_replay, REPLAY_REVEAL, r, c, GetTickCount64() - g_game_t0);
+        apply_changes(&g_changes);
     }
+    TRACE_END("reveal_cell");    /* before any message box (ileti kutusundan önce) */
+    if (!opened) return;
 
-    int n = neigh[r][c];
-    if (n > 0) {
-        wchar_t buf[4];
-        swprintf(buf, 4, L"%d", n);
-        SetWindowTextW(btn, buf);
+    if (board.exploded) {
+        g_game_over = true;
+        g_replay_pending = true;
+        show_mines(true);
+        MessageBoxW(mainWindow, S(STR_LOSE_MSG), S(STR_LOSE_TITLE), MB_OK | MB_ICONERROR);
+        return;
     }
 
-    if (n == 0)
-        for (int dr = -1; dr <= 1; dr++)
-            for (int dc = -1; dc <= 1; dc++) {
-                if (!dr && !dc) continue;
-                int rr = r+dr, cc = c+dc;
-                if (rr >= 0 && rr < ROWS && cc >= 0 && cc < COLS
-                    && !revealed[rr][cc] && !mines_grid[rr][cc] && !flagged[rr][cc])
-                    reveal_cell(rr, cc);
-            }
+    check_win();
+}
 
+/* Take back or reapply one action. Only its cells are repainted, plus the
+   mines when the losing click comes or goes; a redo that wins ends the
+   game as usual. A won game is final: its replay is saved and its dialog
+   shown once (bir eylemi geri al ya da yinele; kazanılan oyun kesindir) */
+static void undo_redo(bool redo) {
+    if (g_deal_pending || board_won(&board)) return;
+    if (!(redo ? journal_redo : journal_undo)(&g_journal, &board, &g_changes)) return;
+    replay_record(&g_replay, redo ? REPLAY_REDO : REPLAY_UNDO, 0, 0, GetTickCount64() - g_game_t0);
+    g_game_over = board.exploded;
+    apply_changes(&g_changes);
+    if (g_show_mines != board.exploded) show_mines(board.exploded);
     check_win();
 }
 
 /* ── Layout engine (Düzen motoru) ────────────────────────────────────── */
 /*
- * Called every time the client area changes size (WM_SIZE).
- * Picks the largest square cell that fits, centers the grid,
- * and batch-repositions all buttons via DeferWindowPos.
+ * Called every time the client area changes size (WM_SIZE) or the zoom
+ * changes. Unless the user zoomed, picks the largest square cell that
+ * fits (at least MIN_CELL — a board too big for that is panned instead),
+ * then sizes the viewport to the smaller of board and client area,
+ * centers it, and keeps the view inside the board.
  *
  * Surplus space around the grid shows as the black background
  * (similar to Windows 7 Minesweeper behavior).
  *
- * (Her boyut değişiminde çağrılır. En büyük kare hücreyi seçer,
- *  ızgarayı ortalar ve tüm butonları toplu taşır. Fazla alan
- *  siyah arka plan olarak görünür — Win7 Minesweeper gibi.)
+ * (Her boyut ya da yakınlaştırma değişiminde çağrılır. Kullanıcı
+ *  yakınlaştırmadıysa sığan en büyük kare hücreyi seçer; görüş alanını
+ *  tahta ile istemci alanının küçüğüne göre boyutlandırır ve ortalar.
+ *  Fazla alan siyah arka plan olarak görünür — Win7 Minesweeper gibi.)
  */
 void relayout(int clientW, int clientH) {
-    if (!mainWindow) return;
+    if (!mainWindow || !gridWnd) return;
+    TRACE_BEGIN("relayout");
+    uint64_t t_layout = now_us();
+#ifdef MINES_PERF
+    double t0 = perf_ms();
+#endif
 
     /* Largest square cell fitting both dimensions (her iki eksene sığan en büyük kare) */
-    int cs = clientW / COLS;
-    if (clientH / ROWS < cs) cs = clientH / ROWS;
-    if (cs < MIN_CELL) cs = MIN_CELL;
+    int cs = cell_size;
+    if (!g_zoomed) {
+        cs = clientW / COLS;
+        if (clientH / ROWS < cs) cs = clientH / ROWS;
+        if (cs < MIN_CELL) cs = MIN_CELL;
+    }
     cell_size = cs;
 
-    /* Center the grid (ızgarayı ortala) */
-    int ox = (clientW  - COLS * cs) / 2;
-    int oy = (clientH  - ROWS * cs) / 2;
+    /* Center the viewport (görüş alanını ortala) */
+    int gw = COLS * cs < clientW ? COLS * cs : clientW;
+    int gh = ROWS * cs < clientH ? ROWS * cs : clientH;
+    int ox = (clientW  - gw) / 2;
+    int oy = (clientH  - gh) / 2;
     if (ox < 0) ox = 0;
     if (oy < 0) oy = 0;
 
-    /* Batch-reposition (toplu yeniden konumlandır) */
-    HDWP hdwp = BeginDeferWindowPos(ROWS * COLS);
-    for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++)
-            if (buttons[r][c])
-                hdwp = DeferWindowPos(hdwp, buttons[r][c], NULL,
-                    ox + c * cs, oy + r * cs,
-                    cs - 1, cs - 1,   /* 1-px gap between cells (hücreler arası 1 piksel boşluk) */
-                    SWP_NOZORDER | SWP_NOACTIVATE);
-    EndDeferWindowPos(hdwp);
+    /* One window to move; cells are only re-rendered when the buffer, the
+       cell size or the clamped view changes
+       (tek pencere taşınır; hücreler yalnızca gerektiğinde yeniden çizilir) */
+    MoveWindow(gridWnd, ox, oy, gw, gh, FALSE);
+    bool repaint = cs != tile_cs;
+    if (repaint) build_tiles(cs);
+    if (gw != grid_w || gh != grid_h) {
+        resize_back_buffer(gw, gh);            /* clamps the view and repaints (görünümü sınırlar ve çizer) */
+    } else {
+        int vx = view_x, vy = view_y;
+        clamp_view();
+        if (repaint || view_x != vx || view_y != vy) refresh_grid();
+    }
 
     InvalidateRect(mainWindow, NULL, TRUE);
+    InvalidateRect(gridWnd, NULL, FALSE);
+#ifdef MINES_PERF
+    perf_log(L"relayout", perf_ms() - t0);
+#endif
+    g_stats.game.relayouts++;
+    g_stats.game.relayout_us += now_us() - t_layout;
+    TRACE_END("relayout");
+}
+
+/* ── View controls (Görünüm denetimleri) ─────────────────────────────── */
+/*
+ * Wheel pans, Shift+wheel or a tilt wheel pans sideways, Ctrl+wheel zooms
+ * around the pointer, the middle button drags, and the arrow and page
+ * keys step through the board. Zooming leaves fitting mode until Fit Board.
+ * (Tekerlek kaydırır, Shift+tekerlek yatay kaydırır, Ctrl+tekerlek
+ *  imlecin çevresinde yakınlaştırır, orta tuş sürükler.)
+ */
+#define WHEEL_CELLS 3         /* cells panned per wheel notch (tekerlek çentiği başına hücre) */
+
+/* Zoom to cell size cs keeping the board point under viewport pixel
+   (px, py) in place; cs = 0 fits the board again (yakınlaştır) */
+static void zoom_view(int cs, int px, int py) {
+    RECT cr; GetClientRect(mainWindow, &cr);
+    if (cs == 0) {
+        g_zoomed = false;
+        relayout(cr.right, cr.bottom);
+        return;
+    }
+    if (cs < MIN_ZOOM) cs = MIN_ZOOM;
+    if (cs > MAX_ZOOM) cs = MAX_ZOOM;
+    if (cs == cell_size) return;
+    view_x = (int)(((long long)view_x + px) * cs / cell_size) - px;
+    view_y = (int)(((long long)view_y + py) * cs / cell_size) - py;
+    cell_size = cs;
+    g_zoomed  = true;
+    relayout(cr.right, cr.bottom);
+}
+
+/* The next cell size up or down, about a quarter apart (bir adım büyük ya da küçük) */
+static int zoom_step(bool in) {
+    int cs = cell_size;
+    return in ? cs + (cs + 3) / 4 : cs - (cs + 4) / 5;
+}
+
+static void wheel(UINT msg, WPARAM wParam, LPARAM lParam) {
+    int delta = GET_WHEEL_DELTA_WPARAM(wParam), keys = GET_KEYSTATE_WPARAM(wParam);
+    POINT pt = {GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam)};
+    ScreenToClient(gridWnd, &pt);
+    int step = delta * WHEEL_CELLS * cell_size / WHEEL_DELTA;
+    if (keys & MK_CONTROL)            zoom_view(zoom_step(delta > 0), pt.x, pt.y);
+    else if (msg == WM_MOUSEHWHEEL)   scroll_view(view_x + step, view_y);
+    else if (keys & MK_SHIFT)         scroll_view(view_x - step, view_y);
+    else                              scroll_view(view_x, view_y - step);
+}
+
+static bool pan_key(WPARAM key) {
+    int cs = cell_size;
+    switch (key) {
+    case VK_LEFT:  scroll_view(view_x - cs, view_y);          return true;
+    case VK_RIGHT: scroll_view(view_x + cs, view_y);          return true;
+    case VK_UP:    scroll_view(view_x, view_y - cs);          return true;
+    case VK_DOWN:  scroll_view(view_x, view_y + cs);          return true;
+    case VK_PRIOR: scroll_view(view_x, view_y - grid_h + cs); return true;
+    case VK_NEXT:  scroll_view(view_x, view_y + grid_h - cs); return true;
+    case VK_HOME:  scroll_view(0, 0);                         return true;
+    }
+    return false;
 }
 
 /* ── Menu (Menü) ─────────────────────────────────────────────────────── */
+/*
+ * Built once. A language switch relabels the existing items in place; the
+ * Language submenu is refilled from the pack folder each time it opens.
+ * (Bir kez kurulur. Dil değişince öğeler yerinde yeniden adlandırılır; Dil
+ *  alt menüsü her açılışta paket klasöründen doldurulur.)
+ */
+static HMENU   g_menu_game, g_menu_options, g_menu_lang;
+static HWND    g_stats_wnd;                    /* statistics panel while open (açıkken istatistik paneli) */
+static wchar_t g_packs[MAX_PACKS][MAX_PATH];   /* pack file names as last listed (son listelenen paketler) */
+static int     g_pack_count;
+
+/* "Undo\tCtrl+Z": the shortcut is not translated (kısayol çevrilmez) */
+static const wchar_t *with_key(StrId id, const wchar_t *key) {
+    static wchar_t buf[96];
+    swprintf(buf, 96, L"%ls\t%ls", S(id), key);
+    return buf;
+}
+
 static HMENU create_menu(void) {
     HMENU hBar     = CreateMenu();
-    HMENU hGame    = CreatePopupMenu();
-    HMENU hOptions = CreatePopupMenu();
-    HMENU hLang    = CreatePopupMenu();
-
-    AppendMenuW(hGame, MF_STRING, IDM_NEW_GAME, S(L"menu_new"));
-    AppendMenuW(hBar,  MF_POPUP,  (UINT_PTR)hGame,    S(L"menu_game"));
-
-    AppendMenuW(hLang, MF_STRING | (lang == 0 ? MF_CHECKED : 0), IDM_LANG_TR, L"Türkçe");
-    AppendMenuW(hLang, MF_STRING | (lang == 1 ? MF_CHECKED : 0), IDM_LANG_EN, L"English");
-    AppendMenuW(hOptions, MF_POPUP,  (UINT_PTR)hLang,    S(L"menu_lang"));
-    AppendMenuW(hOptions, MF_STRING, IDM_SETTINGS,        S(L"menu_settings"));
-    AppendMenuW(hBar,  MF_POPUP,  (UINT_PTR)hOptions, S(L"menu_options"));
+    g_menu_game    = CreatePopupMenu();
+    g_menu_options = CreatePopupMenu();
+    g_menu_lang    = CreatePopupMenu();
+
+    AppendMenuW(g_menu_game, MF_STRING, IDM_NEW_GAME, S(STR_MENU_NEW));
+    AppendMenuW(g_menu_game, MF_SEPARATOR, 0, NULL);
+    AppendMenuW(g_menu_game, MF_STRING, IDM_UNDO, with_key(STR_MENU_UNDO, L"Ctrl+Z"));
+    AppendMenuW(g_menu_game, MF_STRING, IDM_REDO, with_key(STR_MENU_REDO, L"Ctrl+Y"));
+    AppendMenuW(g_menu_game, MF_SEPARATOR, 0, NULL);
+    AppendMenuW(g_menu_game, MF_STRING | (no_guess ? MF_CHECKED : 0), IDM_NO_GUESS, S(STR_MENU_NO_GUESS));
+    AppendMenuW(g_menu_game, MF_SEPARATOR, 0, NULL);
+    AppendMenuW(g_menu_game, MF_STRING, IDM_STATS, S(STR_MENU_STATS));
+    AppendMenuW(hBar,  MF_POPUP,  (UINT_PTR)g_menu_game,    S(STR_MENU_GAME));
+
+    AppendMenuW(g_menu_options, MF_POPUP,  (UINT_PTR)g_menu_lang, S(STR_MENU_LANG));
+    AppendMenuW(g_menu_options, MF_STRING, IDM_SETTINGS,          S(STR_MENU_SETTINGS));
+    AppendMenuW(g_menu_options, MF_SEPARATOR, 0, NULL);
+    AppendMenuW(g_menu_options, MF_STRING, IDM_ZOOM_IN,  with_key(STR_MENU_ZOOM_IN,  L"Ctrl++"));
+    AppendMenuW(g_menu_options, MF_STRING, IDM_ZOOM_OUT, with_key(STR_MENU_ZOOM_OUT, L"Ctrl+-"));
+    AppendMenuW(g_menu_options, MF_STRING, IDM_ZOOM_FIT, with_key(STR_MENU_ZOOM_FIT, L"Ctrl+0"));
+    AppendMenuW(hBar,  MF_POPUP,  (UINT_PTR)g_menu_options, S(STR_MENU_OPTIONS));
 
     return hBar;
 }
 
+/* Relabel the menu for the current language (menüyü yeniden adlandır) */
 void update_menu(void) {
-    HMENU old = GetMenu(mainWindow);
-    SetMenu(mainWindow, create_menu());
-    if (old) DestroyMenu(old);
+    HMENU bar = GetMenu(mainWindow);
+    ModifyMenuW(bar, 0, MF_BYPOSITION | MF_POPUP, (UINT_PTR)g_menu_game,    S(STR_MENU_GAME));
+    ModifyMenuW(bar, 1, MF_BYPOSITION | MF_POPUP, (UINT_PTR)g_menu_options, S(STR_MENU_OPTIONS));
+    ModifyMenuW(g_menu_game, IDM_NEW_GAME, MF_BYCOMMAND | MF_STRING, IDM_NEW_GAME, S(STR_MENU_NEW));
+    ModifyMenuW(g_menu_game, IDM_UNDO, MF_BYCOMMAND | MF_STRING, IDM_UNDO, with_key(STR_MENU_UNDO, L"Ctrl+Z"));
+    ModifyMenuW(g_menu_game, IDM_REDO, MF_BYCOMMAND | MF_STRING, IDM_REDO, with_key(STR_MENU_REDO, L"Ctrl+Y"));
+    ModifyMenuW(g_menu_game, IDM_NO_GUESS, MF_BYCOMMAND | MF_STRING | (no_guess ? MF_CHECKED : 0),
+                IDM_NO_GUESS, S(STR_MENU_NO_GUESS));
+    ModifyMenuW(g_menu_game, IDM_STATS, MF_BYCOMMAND | MF_STRING, IDM_STATS, S(STR_MENU_STATS));
+    ModifyMenuW(g_menu_options, 0, MF_BYPOSITION | MF_POPUP, (UINT_PTR)g_menu_lang, S(STR_MENU_LANG));
+    ModifyMenuW(g_menu_options, IDM_SETTINGS, MF_BYCOMMAND | MF_STRING, IDM_SETTINGS, S(STR_MENU_SETTINGS));
+    ModifyMenuW(g_menu_options, IDM_ZOOM_IN,  MF_BYCOMMAND | MF_STRING, IDM_ZOOM_IN,  with_key(STR_MENU_ZOOM_IN,  L"Ctrl++"));
+    ModifyMenuW(g_menu_options, IDM_ZOOM_OUT, MF_BYCOMMAND | MF_STRING, IDM_ZOOM_OUT, with_key(STR_MENU_ZOOM_OUT, L"Ctrl+-"));
+    ModifyMenuW(g_menu_options, IDM_ZOOM_FIT, MF_BYCOMMAND | MF_STRING, IDM_ZOOM_FIT, with_key(STR_MENU_ZOOM_FIT, L"Ctrl+0"));
     DrawMenuBar(mainWindow);
+    if (g_stats_wnd) SetWindowTextW(g_stats_wnd, S(STR_MENU_STATS));
 }
 
+/* Refill the Language submenu: built-ins, then every readable pack
+   (Dil alt menüsünü doldur: gömülüler, sonra okunabilen her paket) */
+static void fill_lang_menu(void) {
+    while (GetMenuItemCount(g_menu_lang) > 0) DeleteMenu(g_menu_lang, 0, MF_BYPOSITION);
+    AppendMenuW(g_menu_lang, MF_STRING | (lang == 0 ? MF_CHECKED : 0), IDM_LANG_TR, L"Türkçe");
+    AppendMenuW(g_menu_lang, MF_STRING | (lang == 1 ? MF_CHECKED : 0), IDM_LANG_EN, L"English");
+
+    wchar_t pattern[MAX_PATH];
+    WIN32_FIND_DATAW fd;
+    pack_path(pattern, L"*.lng");
+    g_pack_count = 0;
+    HANDLE h = FindFirstFileW(pattern, &fd);
+    if (h == INVALID_HANDLE_VALUE) return;
+    do {
+        wchar_t path[MAX_PATH];
+        HANDLE map;
+        size_t size = 0;
+        pack_path(path, fd.cFileName);
+        const void *view = map_file(path, &map, &size);
+        const uint16_t *name = view ? lang_pack_name(view, size) : NULL;
+        if (name) {
+            int i = g_pack_count++;
+            wcsncpy(g_packs[i], fd.cFileName, MAX_PATH - 1);
+            g_packs[i][MAX_PATH - 1] = 0;
+            bool cur = lang == 2 && _wcsicmp(g_packs[i], g_pack_file) == 0;
+            if (i == 0) AppendMenuW(g_menu_lang, MF_SEPARATOR, 0, NULL);
+            AppendMenuW(g_menu_lang, MF_STRING | (cur ? MF_CHECKED : 0), IDM_LANG_PACK + i, (const wchar_t *)name);
+        }
+        unmap_file(map, view);
+    } while (g_pack_count < MAX_PACKS && FindNextFileW(h, &fd));
+    FindClose(h);
+}
+
+
 /* ── Settings dialog (Ayarlar diyaloğu) ─────────────────────────────── */
 static bool g_dlg_done = false, g_dlg_confirmed = false;
 static int  g_new_rows, g_new_cols, g_new_mines;
+static bool     g_new_seed_set;
+static uint64_t g_new_seed;
 
 LRESULT CALLBACK SettingsDlgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
     switch (msg) {
@@ -308,52 +1294,67 @@ LRESULT CALLBACK SettingsDlgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lPar
         int y = 15, lw = 160, ew = 55, eh = 22, gap = 34;
         HWND h;
 
-        h = CreateWindowW(L"STATIC", S(L"lbl_rows"), WS_CHILD|WS_VISIBLE, 10, y+2, lw, 20, hwnd, NULL, hInst, NULL);
+        h = CreateWindowW(L"STATIC", S(STR_LBL_ROWS), WS_CHILD|WS_VISIBLE, 10, y+2, lw, 20, hwnd, NULL, hInst, NULL);
         SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
         h = CreateWindowW(L"EDIT", L"", WS_CHILD|WS_VISIBLE|WS_BORDER|ES_NUMBER,
             175, y, ew, eh, hwnd, (HMENU)(intptr_t)IDC_ROWS_EDIT, hInst, NULL);
         SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
         y += gap;
 
-        h = CreateWindowW(L"STATIC", S(L"lbl_cols"), WS_CHILD|WS_VISIBLE, 10, y+2, lw, 20, hwnd, NULL, hInst, NULL);
+        h = CreateWindowW(L"STATIC", S(STR_LBL_COLS), WS_CHILD|WS_VISIBLE, 10, y+2, lw, 20, hwnd, NULL, hInst, NULL);
         SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
         h = CreateWindowW(L"EDIT", L"", WS_CHILD|WS_VISIBLE|WS_BORDER|ES_NUMBER,
             175, y, ew, eh, hwnd, (HMENU)(intptr_t)IDC_COLS_EDIT, hInst, NULL);
         SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
         y += gap;
 
-        h = CreateWindowW(L"STATIC", S(L"lbl_mines"), WS_CHILD|WS_VISIBLE, 10, y+2, lw, 20, hwnd, NULL, hInst, NULL);
+        h = CreateWindowW(L"STATIC", S(STR_LBL_MINES), WS_CHILD|WS_VISIBLE, 10, y+2, lw, 20, hwnd, NULL, hInst, NULL);
         SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
-        h = CreateWindowW(L"EDIT", L"", WS_CHILD|WS_VISIBLE|WS_BORDER|ES_NUMBER,
-            175, y, ew, eh, hwnd, (HMENU)(intptr_t)IDC_MINES_EDIT, hInst, NULL);
+        h = CreateWindowW(L"EDIT", L"", WS_CHILD|WS_VISIBLE|WS_BORDER|ES_NUMBER|ES_AUTOHSCROLL,
+            175, y, 2 * ew, eh, hwnd, (HMENU)(intptr_t)IDC_MINES_EDIT, hInst, NULL);
+        SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
+        y += gap;
+
+        /* Hex seed, wide enough for 16 digits (16 basamaklık onaltılık tohum) */
+        h = CreateWindowW(L"STATIC", S(STR_LBL_SEED), WS_CHILD|WS_VISIBLE, 10, y+2, lw, 20, hwnd, NULL, hInst, NULL);
+        SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
+        h = CreateWindowW(L"EDIT", L"", WS_CHILD|WS_VISIBLE|WS_BORDER|ES_UPPERCASE,
+            175, y, 125, eh, hwnd, (HMENU)(intptr_t)IDC_SEED_EDIT, hInst, NULL);
+        SendMessageW(h, EM_LIMITTEXT, 16, 0);
         SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
         y += gap + 10;
 
-        h = CreateWindowW(L"BUTTON", S(L"ok"),     WS_CHILD|WS_VISIBLE|BS_DEFPUSHBUTTON,
-            40,  y, 85, 28, hwnd, (HMENU)(intptr_t)IDC_OK_BTN, hInst, NULL);
+        h = CreateWindowW(L"BUTTON", S(STR_OK),     WS_CHILD|WS_VISIBLE|BS_DEFPUSHBUTTON,
+            65,  y, 85, 28, hwnd, (HMENU)(intptr_t)IDC_OK_BTN, hInst, NULL);
         SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
-        h = CreateWindowW(L"BUTTON", S(L"cancel"), WS_CHILD|WS_VISIBLE|BS_PUSHBUTTON,
-            140, y, 85, 28, hwnd, (HMENU)(intptr_t)IDC_CANCEL_BTN, hInst, NULL);
+        h = CreateWindowW(L"BUTTON", S(STR_CANCEL), WS_CHILD|WS_VISIBLE|BS_PUSHBUTTON,
+            165, y, 85, 28, hwnd, (HMENU)(intptr_t)IDC_CANCEL_BTN, hInst, NULL);
         SendMessageW(h, WM_SETFONT, (WPARAM)hf, FALSE);
 
         /* Fill current values (mevcut değerleri doldur) */
-        wchar_t buf[8];
-        swprintf(buf, 8, L"%d", ROWS);  SetDlgItemTextW(hwnd, IDC_ROWS_EDIT,  buf);
-        swprintf(buf, 8, L"%d", COLS);  SetDlgItemTextW(hwnd, IDC_COLS_EDIT,  buf);
-        swprintf(buf, 8, L"%d", MINES); SetDlgItemTextW(hwnd, IDC_MINES_EDIT, buf);
+        wchar_t buf[16];
+        swprintf(buf, 16, L"%d", ROWS);  SetDlgItemTextW(hwnd, IDC_ROWS_EDIT,  buf);
+        swprintf(buf, 16, L"%d", COLS);  SetDlgItemTextW(hwnd, IDC_COLS_EDIT,  buf);
+        swprintf(buf, 16, L"%d", MINES); SetDlgItemTextW(hwnd, IDC_MINES_EDIT, buf);
         break;
     }
     case WM_COMMAND: {
         int id = LOWORD(wParam);
         if (id == IDC_OK_BTN) {
-            wchar_t buf[8];
-            GetDlgItemTextW(hwnd, IDC_ROWS_EDIT,  buf, 8); int nr = _wtoi(buf);
-            GetDlgItemTextW(hwnd, IDC_COLS_EDIT,  buf, 8); int nc = _wtoi(buf);
-            GetDlgItemTextW(hwnd, IDC_MINES_EDIT, buf, 8); int nm = _wtoi(buf);
-            if (nr < 1 || nr > MAX_ROWS || nc < 1 || nc > MAX_COLS || nm < 1 || nm >= nr * nc) {
-                MessageBoxW(hwnd, S(L"err_invalid"), L"!", MB_OK | MB_ICONWARNING);
+            int nr, nc, nm;
+            bool valid = read_field(hwnd, IDC_ROWS_EDIT, 1, MAX_ROWS, &nr)
+                      && read_field(hwnd, IDC_COLS_EDIT, 1, MAX_COLS, &nc)
+                      && read_field(hwnd, IDC_MINES_EDIT, 1, (long long)nr * nc - 1, &nm);
+            wchar_t sbuf[20], *end;
+            GetDlgItemTextW(hwnd, IDC_SEED_EDIT, sbuf, 20);
+            uint64_t seed = wcstoull(sbuf, &end, 16);
+            if (!valid) {
+                MessageBoxW(hwnd, S(STR_ERR_INVALID), L"!", MB_OK | MB_ICONWARNING);
+            } else if (*end != L'\0') {
+                MessageBoxW(hwnd, S(STR_ERR_SEED), L"!", MB_OK | MB_ICONWARNING);
             } else {
                 g_new_rows = nr; g_new_cols = nc; g_new_mines = nm;
+                g_new_seed_set = sbuf[0] != L'\0'; g_new_seed = seed;
                 g_dlg_confirmed = true;
                 DestroyWindow(hwnd);
             }
@@ -372,13 +1373,13 @@ static void show_settings_dialog(void) {
     g_dlg_done = false; g_dlg_confirmed = false;
 
     RECT rc; GetWindowRect(mainWindow, &rc);
-    int dlgW = 245, dlgH = 190;
+    int dlgW = 320, dlgH = 224;
     int x = rc.left + (rc.right  - rc.left - dlgW) / 2;
     int y = rc.top  + (rc.bottom - rc.top  - dlgH) / 2;
 
     EnableWindow(mainWindow, FALSE);
     HWND dlg = CreateWindowExW(WS_EX_DLGMODALFRAME,
-        L"SettingsDlgClass", S(L"dlg_title"),
+        L"SettingsDlgClass", S(STR_DLG_TITLE),
         WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU,
         x, y, dlgW, dlgH, mainWindow, NULL, hInst, NULL);
     ShowWindow(dlg, SW_SHOW); UpdateWindow(dlg);
@@ -392,61 +1393,86 @@ static void show_settings_dialog(void) {
 
     if (g_dlg_confirmed) {
         ROWS = g_new_rows; COLS = g_new_cols; MINES = g_new_mines;
+        g_seed_set = g_new_seed_set; g_seed_next = g_new_seed;
         save_settings();
-        rebuild_buttons();
+        init_game();
+        view_x = view_y = 0;                   /* a new board starts fitted (yeni tahta sığdırılarak başlar) */
+        g_zoomed = false;
         /* Re-run layout with current client size (mevcut boyutuyla düzenle) */
         RECT cr; GetClientRect(mainWindow, &cr);
         relayout(cr.right, cr.bottom);
     }
 }
 
-/* ── Button (re)creation (Buton oluşturma/yeniden oluşturma) ─────────── */
-void rebuild_buttons(void) {
-    /* Destroy old buttons (eski butonları yok et) */
-    for (int r = 0; r < MAX_ROWS; r++)
-        for (int c = 0; c < MAX_COLS; c++)
-            if (buttons[r][c]) { DestroyWindow(buttons[r][c]); buttons[r][c] = NULL; }
-
-    /* Create new grid — positions are set later by relayout() (konumlar relayout tarafından ayarlanır) */
-    for (int r = 0; r < ROWS; r++)
-        for (int c = 0; c < COLS; c++) {
-            int id = BASE_ID + r * COLS + c;
-            buttons[r][c] = CreateWindowW(L"BUTTON", L"",
-                WS_CHILD | WS_VISIBLE | BS_PUSHBUTTON | BS_OWNERDRAW,
-                0, 0, cell_size - 1, cell_size - 1,
-                mainWindow, (HMENU)(intptr_t)id, hInst, NULL);
-            oldButtonProc[r][c] = (WNDPROC)SetWindowLongPtrW(
-                buttons[r][c], GWLP_WNDPROC, (LONG_PTR)ButtonProc);
-            SendMessageW(buttons[r][c], WM_SETFONT,
-                (WPARAM)GetStockObject(DEFAULT_GUI_FONT), TRUE);
-        }
-    init_game();
-}
-
-/* ── Right-click subclass for flag toggling (Bayrak için sağ-tık alt sınıfı) */
-LRESULT CALLBACK ButtonProc(HWND hwndBtn, UINT msg, WPARAM wParam, LPARAM lParam) {
-    if (msg == WM_RBUTTONUP) {
-        int id = GetDlgCtrlID(hwndBtn);
-        if (id >= BASE_ID && id < BASE_ID + ROWS * COLS) {
-            int r, c; idx_from_id(id, &r, &c);
-            if (!revealed[r][c]) {
-                flagged[r][c] = !flagged[r][c];
-                SetWindowTextW(buttons[r][c], flagged[r][c] ? L"F" : L"");
-                InvalidateRect(buttons[r][c], NULL, TRUE);
-            }
-        }
+/* ── Statistics panel (İstatistik paneli) ────────────────────────────── */
+/*
+ * A modeless window over the counters, refreshed twice a second while it
+ * is open; the text can be selected and copied. The same text is written
+ * to %APPDATA%\MinesGame\stats.txt at exit.
+ * (Sayaçları gösteren kipsiz pencere; açıkken saniyede iki kez yenilenir,
+ *  metin seçilip kopyalanabilir. Aynı metin çıkışta stats.txt'ye yazılır.)
+ */
+#define STATS_TEXT 2048
+
+static HWND    g_stats_edit;
+static wchar_t g_stats_shown[STATS_TEXT];
+
+static void update_stats_panel(void) {
+    char buf[STATS_TEXT];
+    wchar_t text[STATS_TEXT];
+    size_t n = stats_format(&g_stats, GetTickCount64(), buf, sizeof buf);
+    if (n >= STATS_TEXT) n = STATS_TEXT - 1;
+    for (size_t i = 0; i < n; i++) text[i] = (unsigned char)buf[i];   /* ASCII */
+    text[n] = 0;
+    if (wcscmp(text, g_stats_shown) == 0) return;   /* no flicker when idle (boştayken titreme yok) */
+    wcscpy(g_stats_shown, text);
+    SetWindowTextW(g_stats_edit, text);
+}
+
+LRESULT CALLBACK StatsProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+    switch (msg) {
+    case WM_CREATE:
+        g_stats_edit = CreateWindowW(L"EDIT", L"", WS_CHILD | WS_VISIBLE | WS_VSCROLL | ES_MULTILINE | ES_READONLY,
+            0, 0, 0, 0, hwnd, NULL, hInst, NULL);
+        SendMessageW(g_stats_edit, WM_SETFONT, (WPARAM)GetStockObject(ANSI_FIXED_FONT), FALSE);
+        g_stats_shown[0] = 0;
+        update_stats_panel();
+        SetTimer(hwnd, 1, 500, NULL);
+        return 0;
+    case WM_SIZE:
+        MoveWindow(g_stats_edit, 0, 0, LOWORD(lParam), HIWORD(lParam), TRUE);
+        return 0;
+    case WM_TIMER:
+        update_stats_panel();
+        return 0;
+    case WM_DESTROY:
+        KillTimer(hwnd, 1);
+        g_stats_wnd = NULL;
         return 0;
     }
-    int id = GetDlgCtrlID(hwndBtn);
-    if (id >= BASE_ID && id < BASE_ID + ROWS * COLS) {
-        int r, c; idx_from_id(id, &r, &c);
-        return CallWindowProcW(oldButtonProc[r][c], hwndBtn, msg, wParam, lParam);
-    }
-    return DefWindowProcW(hwndBtn, msg, wParam, lParam);
+    return DefWindowProcW(hwnd, msg, wParam, lParam);
+}
+
+static void show_stats_panel(void) {
+    if (g_stats_wnd) { SetForegroundWindow(g_stats_wnd); return; }
+    RECT rc; GetWindowRect(mainWindow, &rc);
+    g_stats_wnd = CreateWindowExW(WS_EX_TOOLWINDOW, L"StatsPanelClass", S(STR_MENU_STATS),
+        WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU | WS_THICKFRAME,
+        rc.right, rc.top, 420, 330, mainWindow, NULL, hInst, NULL);
+    if (g_stats_wnd) ShowWindow(g_stats_wnd, SW_SHOWNOACTIVATE);
+}
+
+/* The panel's text as a file (panel metni dosyaya) */
+static void save_stats(void) {
+    wchar_t path[MAX_PATH];
+    char *buf = malloc(STATS_TEXT);
+    if (!buf || !app_path(path, L"stats.txt")) { free(buf); return; }
+    size_t n = stats_format(&g_stats, GetTickCount64(), buf, STATS_TEXT);
+    write_async(path, (uint8_t *)buf, n < STATS_TEXT ? n : STATS_TEXT - 1);
 }
 
 /* ── Main window procedure (Ana pencere yordamı) ─────────────────────── */
-LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+static LRESULT main_proc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
     switch (msg) {
 
     /* Resize: recalculate cell size and reposition grid (yeniden boyutlandırma) */
@@ -458,13 +1484,22 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
     /* Enforce a sensible minimum so cells never collapse (minimum pencere boyutu) */
     case WM_GETMINMAXINFO: {
         MINMAXINFO *mmi = (MINMAXINFO*)lParam;
-        RECT rc = {0, 0, COLS * MIN_CELL, ROWS * MIN_CELL};
+        RECT rc = {0, 0, (COLS < 16 ? COLS : 16) * MIN_CELL, (ROWS < 16 ? ROWS : 16) * MIN_CELL};
         AdjustWindowRectEx(&rc, (DWORD)GetWindowLongW(hwnd, GWL_STYLE), TRUE, 0);
         mmi->ptMinTrackSize.x = rc.right  - rc.left;
         mmi->ptMinTrackSize.y = rc.bottom - rc.top;
         break;
     }
 
+    case WM_MOUSEWHEEL:
+    case WM_MOUSEHWHEEL:
+        wheel(msg, wParam, lParam);
+        return 0;
+
+    case WM_KEYDOWN:
+        if (pan_key(wParam)) return 0;
+        break;
+
     /* Dark background outside the grid — Win7 Minesweeper style
        (ızgara dışında koyu arka plan, Win7 Minesweeper gibi) */
     case WM_ERASEBKGND: {
@@ -477,73 +1512,35 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
         int id = LOWORD(wParam);
         if (id == IDM_NEW_GAME) {
             init_game(); InvalidateRect(hwnd, NULL, TRUE);
-        } else if (id == IDM_LANG_TR) {
-            lang = 0; save_settings(); update_menu();
-        } else if (id == IDM_LANG_EN) {
-            lang = 1; save_settings(); update_menu();
+        } else if (id == IDM_UNDO || id == IDM_REDO) {
+            undo_redo(id == IDM_REDO);
+        } else if (id == IDM_STATS) {
+            show_stats_panel();
+        } else if (id == IDM_ZOOM_IN || id == IDM_ZOOM_OUT) {
+            zoom_view(zoom_step(id == IDM_ZOOM_IN), grid_w / 2, grid_h / 2);
+        } else if (id == IDM_ZOOM_FIT) {
+            zoom_view(0, 0, 0);
+        } else if (id == IDM_NO_GUESS) {
+            no_guess = !no_guess; save_settings(); update_menu();
+            init_game(); InvalidateRect(hwnd, NULL, TRUE);
+        } else if (id == IDM_LANG_TR || id == IDM_LANG_EN) {
+            set_language(id == IDM_LANG_TR ? 0 : 1, NULL); save_settings(); update_menu(); update_title();
+        } else if (id >= IDM_LANG_PACK && id < IDM_LANG_PACK + g_pack_count) {
+            set_language(2, g_packs[id - IDM_LANG_PACK]); save_settings(); update_menu(); update_title();
         } else if (id == IDM_SETTINGS) {
             show_settings_dialog();
-        } else if (id >= BASE_ID && id < BASE_ID + ROWS * COLS) {
-            int r, c; idx_from_id(id, &r, &c);
-            if (!flagged[r][c] && !revealed[r][c]) reveal_cell(r, c);
         }
         break;
     }
 
-    case WM_DRAWITEM: {
-        LPDRAWITEMSTRUCT dis = (LPDRAWITEMSTRUCT)lParam;
-        if (!dis) break;
-        int idx = (int)dis->CtlID - BASE_ID;
-        if (idx < 0 || idx >= ROWS * COLS)
-            return DefWindowProcW(hwnd, msg, wParam, lParam);
-        int r = idx / COLS, c = idx % COLS;
-
-        /* Cell background (hücre arka planı) */
-        HBRUSH br = CreateSolidBrush(revealed[r][c] ? RGB(192,192,192) : RGB(220,220,220));
-        FillRect(dis->hDC, &dis->rcItem, br);
-        DeleteObject(br);
-
-        /* 3-D edge (3-D kenar) */
-        DrawEdge(dis->hDC, &dis->rcItem,
-            (dis->itemState & ODS_SELECTED) ? BDR_SUNKENINNER : BDR_RAISEDINNER, BF_RECT);
-
-        /* Text (metin) — skip if empty (boşsa atla) */
-        wchar_t buf[8] = L"";
-        GetWindowTextW(dis->hwndItem, buf, 8);
-        if (buf[0] == L'\0') return TRUE;
-
-        SetBkMode(dis->hDC, TRANSPARENT);
-
-        /* Classic Minesweeper digit colors (klasik sayı renkleri) */
-        static const COLORREF numColors[] = {
-            0,
-            RGB(0,   0, 200),  /* 1 – blue (mavi) */
-            RGB(0, 130,   0),  /* 2 – green (yeşil) */
-            RGB(200,  0,   0), /* 3 – red (kırmızı) */
-            RGB(0,   0, 130),  /* 4 – dark blue (koyu mavi) */
-            RGB(130,  0,   0), /* 5 – dark red (koyu kırmızı) */
-            RGB(0,  130, 130), /* 6 – teal (camgöbeği) */
-            RGB(80,  80,  80), /* 7 – dark grey (koyu gri) */
-            RGB(80,  80,  80), /* 8 – dark grey (koyu gri) */
-        };
-
-        COLORREF col;
-        if (flagged[r][c] && !revealed[r][c]) {
-            col = RGB(200, 0, 0);                   /* flag: red (bayrak: kırmızı) */
-        } else if (revealed[r][c] && !mines_grid[r][c]) {
-            int n = neigh[r][c];
-            col = (n >= 1 && n <= 8) ? numColors[n] : RGB(0, 0, 0);
-        } else {
-            col = RGB(60, 60, 60);                  /* mine / disabled (mayın / devre dışı) */
+    case WM_INITMENUPOPUP:
+        if ((HMENU)wParam == g_menu_lang) fill_lang_menu();
+        if ((HMENU)wParam == g_menu_game) {
+            bool won = board_won(&board);
+            EnableMenuItem(g_menu_game, IDM_UNDO, MF_BYCOMMAND | (!won && journal_can_undo(&g_journal) ? MF_ENABLED : MF_GRAYED));
+            EnableMenuItem(g_menu_game, IDM_REDO, MF_BYCOMMAND | (!won && journal_can_redo(&g_journal) ? MF_ENABLED : MF_GRAYED));
         }
-
-        HFONT hf  = (HFONT)SendMessageW(dis->hwndItem, WM_GETFONT, 0, 0);
-        HFONT old = (HFONT)SelectObject(dis->hDC, hf);
-        SetTextColor(dis->hDC, col);
-        DrawTextW(dis->hDC, buf, -1, &dis->rcItem, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-        SelectObject(dis->hDC, old);
-        return TRUE;
-    }
+        break;
 
     case WM_CLOSE:   DestroyWindow(hwnd); break;
     case WM_DESTROY: PostQuitMessage(0);  break;
@@ -552,11 +1549,24 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
     return 0;
 }
 
+LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+    TRACE_BEGIN_ARG("WndProc", msg);
+    LRESULT res = main_proc(hwnd, msg, wParam, lParam);
+    TRACE_END("WndProc");
+    return res;
+}
+
 /* ── Entry point (Giriş noktası) ─────────────────────────────────────── */
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrev, PWSTR pCmd, int nCmdShow) {
+#ifdef MINES_PERF
+    double t_start = perf_ms();
+#endif
     hInst = hInstance;
-    srand((unsigned)time(NULL));
     load_settings();
+    set_language(lang, g_pack_file);
+    bool resumed = resume_game();     /* before sizing: it may change ROWS/COLS (boyutlandırmadan önce) */
+    pool_start(&g_pool, new_seed(), PARALLEL_REVEAL_CELLS);
+    want_boards();
 
     /* Register main window class (ana pencere sınıfını kaydet) */
     WNDCLASSW wc = {0};
@@ -576,12 +1586,30 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrev, PWSTR pCmd, int nCmdSh
     wcs.hCursor       = LoadCursor(NULL, IDC_ARROW);
     RegisterClassW(&wcs);
 
+    /* Register grid control class (ızgara denetimi sınıfını kaydet) */
+    WNDCLASSW wcg = {0};
+    wcg.lpfnWndProc   = GridProc;
+    wcg.hInstance     = hInstance;
+    wcg.lpszClassName = L"MinesGridClass";
+    wcg.hbrBackground = NULL;   /* painted from the back buffer (arka tampondan çizilir) */
+    wcg.hCursor       = LoadCursor(NULL, IDC_ARROW);
+    RegisterClassW(&wcg);
+
+    /* Register statistics panel class (istatistik paneli sınıfını kaydet) */
+    WNDCLASSW wst = {0};
+    wst.lpfnWndProc   = StatsProc;
+    wst.hInstance     = hInstance;
+    wst.lpszClassName = L"StatsPanelClass";
+    wst.hbrBackground = (HBRUSH)(COLOR_BTNFACE + 1);
+    wst.hCursor       = LoadCursor(NULL, IDC_ARROW);
+    RegisterClassW(&wst);
+
     /*
      * Compute initial window size from DEF_CELL, then clamp to the OS work area
      * so large grids (e.g. 30x30) don't start off-screen, and center on screen.
      * (Başlangıç boyutunu hesapla, görev çubuğu hariç çalışma alanına sığdır, ortala.)
      */
-    DWORD winStyle = WS_OVERLAPPEDWINDOW;   /* resizable + maximizable (boyutlandırılabilir + büyütülebilir) */
+    DWORD winStyle = WS_OVERLAPPEDWINDOW | WS_CLIPCHILDREN;   /* resizable + maximizable (boyutlandırılabilir + büyütülebilir) */
 
     RECT wa;
     SystemParametersInfoW(SPI_GETWORKAREA, 0, &wa, 0);
@@ -608,12 +1636,13 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrev, PWSTR pCmd, int nCmdSh
 
     SetMenu(mainWindow, create_menu());
 
-    /* Initialize button array (buton dizisini sıfırla) */
-    for (int r = 0; r < MAX_ROWS; r++)
-        for (int c = 0; c < MAX_COLS; c++)
-            buttons[r][c] = NULL;
+    /* The grid control — positioned by relayout() (konumu relayout tarafından ayarlanır) */
+    gridWnd = CreateWindowW(L"MinesGridClass", L"", WS_CHILD | WS_VISIBLE,
+        0, 0, 0, 0, mainWindow, NULL, hInstance, NULL);
+    if (!gridWnd) return 0;
 
-    rebuild_buttons();
+    if (resumed) { stats_new_game(&g_stats, GetTickCount64()); refresh_grid(); update_title(); }
+    else         init_game();
 
     /* Run first layout pass with the actual client size (gerçek istemci boyutuyla ilk düzeni çalıştır) */
     RECT cr; GetClientRect(mainWindow, &cr);
@@ -621,11 +1650,37 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrev, PWSTR pCmd, int nCmdSh
 
     ShowWindow(mainWindow, nCmdShow);
     UpdateWindow(mainWindow);
+#ifdef MINES_PERF
+    perf_log(L"startup", perf_ms() - t_start);
+#endif
+
+    ACCEL keys[] = {
+        {FVIRTKEY | FCONTROL, 'Z', IDM_UNDO},
+        {FVIRTKEY | FCONTROL, 'Y', IDM_REDO},
+        {FVIRTKEY | FCONTROL, VK_OEM_PLUS,  IDM_ZOOM_IN},
+        {FVIRTKEY | FCONTROL, VK_ADD,       IDM_ZOOM_IN},
+        {FVIRTKEY | FCONTROL, VK_OEM_MINUS, IDM_ZOOM_OUT},
+        {FVIRTKEY | FCONTROL, VK_SUBTRACT,  IDM_ZOOM_OUT},
+        {FVIRTKEY | FCONTROL, '0',          IDM_ZOOM_FIT},
+    };
+    HACCEL accel = CreateAcceleratorTableW(keys, sizeof keys / sizeof *keys);
 
     MSG m;
     while (GetMessageW(&m, NULL, 0, 0)) {
+        if (accel && TranslateAcceleratorW(mainWindow, accel, &m)) continue;
         TranslateMessage(&m);
         DispatchMessage(&m);
     }
+    if (accel) DestroyAcceleratorTable(accel);
+    settle_replay(false);
+    autosave();
+    save_stats();
+    pool_stop(&g_pool);
+    writer_wait();                /* the window is gone; finish the last write (son yazmayı bitir) */
+#ifdef MINES_TRACE
+    wchar_t trace_path[MAX_PATH];
+    FILE *tf = app_path(trace_path, L"trace.json") ? _wfopen(trace_path, L"w") : NULL;
+    if (tf) { trace_dump(tf); fclose(tf); }
+#endif
     return (int)m.wParam;
 }
@@ -0,0 +1,262 @@
+#include "openings.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define NONE UINT32_MAX
+
+static bool reserve(void **p, size_t *cap, size_t n, size_t size) {
+    if (n <= *cap) return true;
+    size_t want = *cap * 2 > n ? *cap * 2 : n;
+    void *q = realloc(*p, want * size);
+    if (!q) return false;
+    *p = q; *cap = want;
+    return true;
+}
+
+void openings_clear(Openings *o) {
+    o->rows = o->cols = 0;
+    o->count = o->n_runs = o->n_edges = 0;
+}
+
+void openings_free(Openings *o) {
+    free(o->label);
+    free(o->open);
+    free(o->runs);
+    free(o->edges);
+    free(o->pairs);
+    memset(o, 0, sizeof *o);
+}
+
+/* ── Union-find (Birleşim-bul) ───────────────────────────────────────── */
+/* Roots are the smallest index of their set, so a parent never follows
+   its child in raster order (kök kümenin en küçük indeksidir) */
+static uint32_t find(uint32_t *p, uint32_t x) {
+    while (p[x] != x) { p[x] = p[p[x]]; x = p[x]; }   /* path halving (yol yarılama) */
+    return x;
+}
+
+static void unite(uint32_t *p, uint32_t a, uint32_t b) {
+    a = find(p, a);
+    b = find(p, b);
+    if (a < b) p[b] = a;
+    else if (b < a) p[a] = b;
+}
+
+/* Distinct openings next to the numbered cell (r, c), at most four
+   (sayılı hücreye komşu farklı açıklıklar, en çok dört) */
+static int next_to(const Openings *o, int r, int c, uint32_t ids[4]) {
+    int n = 0;
+    for (int dr = -1; dr <= 1; dr++) {
+        int rr = r + dr;
+        if (rr < 0 || rr >= o->rows) continue;
+        for (int dc = -1; dc <= 1; dc++) {
+            int cc = c + dc;
+            if (cc < 0 || cc >= o->cols) continue;
+            uint32_t l = o->label[(size_t)rr * o->cols + cc];
+            if (!l) continue;
+            int k = 0;
+            while (k < n && ids[k] != l - 1) k++;
+            if (k == n) ids[n++] = l - 1;
+        }
+    }
+    return n;
+}
+
+/* First cell at or after x whose bit equals `set`, or end (x'ten sonra
+   biti `set` olan ilk hücre) */
+static int scan(const uint64_t *row, int x, int end, bool set) {
+    while (x < end) {
+        uint64_t w = set ? row[x >> 6] : ~row[x >> 6];
+        w >>= x & 63;
+        if (w) { x += __builtin_ctzll(w); break; }
+        x = (x | 63) + 1;
+    }
+    return x < end ? x : end;
+}
+
+static inline uint64_t pack(uint32_t hi, uint32_t lo) { return (uint64_t)hi << 32 | lo; }
+
+/*
+ * Zero cells come from a bit-plane of the board, so every pass works on
+ * whole runs. (1) Each cell of a zero run points at the run's first cell,
+ * which is united with every run touching it in the row above. (2) Runs
+ * become labels in raster order: a root takes the next opening number,
+ * any other run copies its parent's label, which lies earlier and is
+ * final; the label is then written over the run's cells. (3) The boundary
+ * is the zero plane dilated by one, minus the zeros — no mine ever
+ * touches a zero. Runs and boundary cells are collected in raster order
+ * and grouped by opening with a counting sort.
+ *
+ * ((1) sıfır dizisinin her hücresi dizinin ilk hücresini gösterir, o da
+ *  üst satırda değdiği dizilerle birleştirilir; (2) kökler sıradaki
+ *  numarayı alır, diğer diziler ebeveynin etiketini kopyalar; (3) kenar =
+ *  bir genişletilmiş sıfır düzlemi eksi sıfırlar. Diziler ve kenarlar
+ *  sayma sıralamasıyla açıklığa göre gruplanır.)
+ */
+bool openings_build(Openings *o, const Board *b) {
+    openings_clear(o);
+    const int R = b->rows, C = b->cols;
+    size_t n = (size_t)R * C, n_runs = 0, n_edges = 0, count = 0;
+    BitPlane zp = {0}, edge = {0};
+    bool ok = reserve((void **)&o->label, &o->label_cap, n, sizeof *o->label)
+           && plane_setup(&zp, R, C) && plane_setup(&edge, R, C);
+    if (!ok) goto done;
+    board_extract_plane(b, CELL_COUNT | CELL_MINE, 0, &zp);
+
+    uint32_t *p = o->label;
+    memset(p, 0, n * sizeof *p);                      /* 0: no opening (açıklık yok) */
+    for (int r = 0; r < R; r++) {
+        const uint64_t *row = plane_row(&zp, r), *up = plane_row(&zp, r - 1);
+        uint32_t *pr = p + (size_t)r * C;
+        for (int x0 = scan(row, 0, C, true); x0 < C; x0 = scan(row, x0 + 1, C, true)) {
+            int x1 = scan(row, x0, C, false) - 1;
+            uint32_t at = (uint32_t)((size_t)r * C + x0);
+            if (!(ok = reserve((void **)&o->pairs, &o->pairs_cap, n_runs + 1, sizeof *o->pairs))) goto done;
+            o->pairs[n_runs++] = pack(at, (uint32_t)(x1 - x0 + 1));
+            for (int x = x0; x <= x1; x++) pr[x] = at;
+            if (r > 0) {
+                int lo = x0 > 0 ? x0 - 1 : 0, hi = x1 < C - 1 ? x1 + 1 : C - 1;
+                for (int x = scan(up, lo, hi + 1, true); x <= hi; x = scan(up, scan(up, x, hi + 1, false), hi + 1, true))
+                    unite(p, at, (uint32_t)((size_t)(r - 1) * C + x));
+            }
+            x0 = x1;
+        }
+    }
+
+    for (size_t j = 0; j < n_runs; j++) {
+        uint32_t at = (uint32_t)(o->pairs[j] >> 32), q = p[at];
+        if (q == at) {
+            if (!(ok = reserve((void **)&o->open, &o->open_cap, count + 1, sizeof *o->open))) goto done;
+            memset(&o->open[count], 0, sizeof *o->open);
+            p[at] = (uint32_t)++count;
+        } else {
+            p[at] = p[q];
+        }
+        Opening *op = &o->open[p[at] - 1];
+        op->runs++;
+        op->zeros += (uint32_t)o->pairs[j];
+    }
+    for (size_t j = 0; j < n_runs; j++) {
+        uint32_t at = (uint32_t)(o->pairs[j] >> 32), len = (uint32_t)o->pairs[j];
+        for (uint32_t x = 1; x < len; x++) p[at + x] = p[at];
+    }
+
+    size_t total = 0;
+    for (size_t k = 0; k < count; k++) {
+        o->open[k].run = total;
+        total += o->open[k].runs;
+        o->open[k].runs = 0;
+    }
+    if (!(ok = reserve((void **)&o->runs, &o->runs_cap, n_runs, sizeof *o->runs))) goto done;
+    for (size_t j = 0; j < n_runs; j++) {
+        uint32_t at = (uint32_t)(o->pairs[j] >> 32);
+        Opening *op = &o->open[p[at] - 1];
+        o->runs[op->run + op->runs++] = (ZeroRun){at, (uint32_t)o->pairs[j]};
+    }
+    o->rows = R;
+    o->cols = C;
+
+    plane_dilate(&zp, &edge, PLANE_AUTO);
+    for (int r = 0; r < R; r++) {
+        uint64_t *e = plane_row(&edge, r);
+        const uint64_t *z = plane_row(&zp, r);
+        for (size_t w = 0; w < edge.stride; w++) e[w] &= ~z[w];
+        for (int c = scan(e, 0, C, true); c < C; c = scan(e, c + 1, C, true)) {
+            uint32_t ids[4];
+            int k = next_to(o, r, c, ids);
+            if (!(ok = reserve((void **)&o->pairs, &o->pairs_cap, n_edges + (size_t)k, sizeof *o->pairs))) goto done;
+            while (k-- > 0) {
+                o->pairs[n_edges++] = pack((uint32_t)((size_t)r * C + c), ids[k]);
+                o->open[ids[k]].edges++;
+            }
+        }
+    }
+
+    total = 0;
+    for (size_t k = 0; k < count; k++) {
+        Opening *op = &o->open[k];
+        op->edge = total;
+        total += op->edges;
+        op->size = op->zeros + op->edges;
+        op->edges = 0;
+    }
+    if (!(ok = reserve((void **)&o->edges, &o->edges_cap, n_edges, sizeof *o->edges))) goto done;
+    for (size_t j = 0; j < n_edges; j++) {
+        Opening *op = &o->open[(uint32_t)o->pairs[j]];
+        o->edges[op->edge + op->edges++] = (uint32_t)(o->pairs[j] >> 32);
+    }
+    o->count   = count;
+    o->n_runs  = n_runs;
+    o->n_edges = n_edges;
+
+done:
+    if (!ok) openings_clear(o);
+    plane_free(&zp);
+    plane_free(&edge);
+    return ok;
+}
+
+/* ── Reveal (Açma) ───────────────────────────────────────────────────── */
+/* Any cell of the run matching mask, chunk by chunk (maskeye uyan hücre var mı) */
+static bool run_has(const Board *b, ZeroRun z, uint8_t mask) {
+    int r = (int)(z.at / (uint32_t)b->cols), c = (int)(z.at % (uint32_t)b->cols), end = c + (int)z.len;
+    unsigned rz = zorder_spread((unsigned)r) << 1;
+    while (c < end) {
+        int stop = (c | (CHUNK_DIM - 1)) + 1 < end ? (c | (CHUNK_DIM - 1)) + 1 : end;
+        const Chunk *k = board_chunk(b, r, c);
+        if (k)
+            for (int x = c; x < stop; x++)
+                if (k->cell[rz | zorder_spread((unsigned)x)] & mask) return true;
+        c = stop;
+    }
+    return false;
+}
+
+static bool open_run(Board *b, ZeroRun z, ChangeSet *out) {
+    int r = (int)(z.at / (uint32_t)b->cols), c = (int)(z.at % (uint32_t)b->cols), end = c + (int)z.len;
+    unsigned rz = zorder_spread((unsigned)r) << 1;
+    while (c < end) {
+        int stop = (c | (CHUNK_DIM - 1)) + 1 < end ? (c | (CHUNK_DIM - 1)) + 1 : end;
+        Chunk *k = board_touch(b, r, c);
+        if (!k) return false;
+        for (int x = c; x < stop; x++) {
+            uint8_t *v = &k->cell[rz | zorder_spread((unsigned)x)];
+            *v |= CELL_REVEALED;
+            if (out) changes_add(out, r, x, *v);
+        }
+        b->revealed_count += stop - c;
+        c = stop;
+    }
+    return true;
+}
+
+int openings_reveal(const Openings *o, Board *b, int r, int c, ChangeSet *out) {
+    long id = o->rows == b->rows && o->cols == b->cols ? openings_at(o, r, c) : -1;
+    if (id < 0) return board_reveal(b, r, c, out);
+    const Opening  *op   = &o->open[id];
+    const ZeroRun  *run  = o->runs + op->run;
+    const uint32_t *edge = o->edges + op->edge;
+    const int C = b->cols;
+
+    /* The flood would stop at a flag or an open zero (bayrak ya da açık sıfır yayılmayı durdurur) */
+    for (uint32_t i = 0; i < op->runs; i++)
+        if (run_has(b, run[i], CELL_REVEALED | CELL_FLAGGED)) return board_reveal(b, r, c, out);
+    for (uint32_t i = 0; i < op->edges; i++)
+        if (board_flagged(b, (int)(edge[i] / (uint32_t)C), (int)(edge[i] % (uint32_t)C))) return board_reveal(b, r, c, out);
+
+    int before = b->revealed_count;
+    for (uint32_t i = 0; i < op->runs; i++)
+        if (!open_run(b, run[i], out)) return b->revealed_count - before;
+    for (uint32_t i = 0; i < op->edges; i++) {
+        int er = (int)(edge[i] / (uint32_t)C), ec = (int)(edge[i] % (uint32_t)C);
+        Chunk *k = board_touch(b, er, ec);
+        if (!k) break;
+        uint8_t *v = &k->cell[chunk_index(er, ec)];
+        if (*v & CELL_REVEALED) continue;              /* opened earlier (önceden açılmış) */
+        *v |= CELL_REVEALED;
+        b->revealed_count++;
+        if (out) changes_add(out, er, ec, *v);
+    }
+    return b->revealed_count - before;
+}
@@ -0,0 +1,83 @@
+/*
+ * openings.h — index of a board's openings (açıklık dizini)
+ *
+ * An opening is a maximal 8-connected region of zero cells together with
+ * its boundary: the numbered cells touching it. Clicking any of its zeros
+ * on an untouched board opens exactly that set. openings_build labels the
+ * zero regions with a single raster pass of union-find over runs of zeros,
+ * right after the neighbor counts are known, and lists each opening's
+ * zero runs and boundary cells, so a reveal walks flat lists instead of
+ * flooding. A numbered cell between two openings is listed in both.
+ *
+ * The index depends only on the mines; flags and revealed cells are
+ * checked when it is used, so it stays valid for the whole game.
+ *
+ * (Açıklık, birbirine 8-bağlı sıfır hücreler ve onlara değen sayılı
+ *  hücrelerdir. openings_build sıfır bölgelerini tek geçişli birleşim-bul
+ *  ile etiketler, her açıklığın sıfır dizilerini ve kenar hücrelerini
+ *  listeler; açma, doldurma yerine bu listeleri dolaşır. Dizin yalnızca
+ *  mayınlara bağlıdır.)
+ */
+#ifndef OPENINGS_H
+#define OPENINGS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+
+/* Zero cells at + 0 … at + len - 1, all in one row (tek satırdaki sıfırlar) */
+typedef struct ZeroRun {
+    uint32_t at;              /* row-major index of the first (ilk hücrenin indeksi) */
+    uint32_t len;
+} ZeroRun;
+
+typedef struct Opening {
+    size_t   run, edge;       /* first entries in runs[] and edges[] (ilk kayıtlar) */
+    uint32_t runs, edges;
+    uint32_t zeros;           /* cells in its runs (dizilerindeki hücreler) */
+    uint32_t size;            /* zeros + edges: what one click opens (bir tıklamanın açtığı) */
+} Opening;
+
+typedef struct Openings {
+    int       rows, cols;     /* 0 × 0 when nothing is indexed (dizin yoksa 0) */
+    uint32_t *label;          /* per cell, row-major: 1 + opening of a zero, else 0 (hücre etiketi) */
+    Opening  *open;
+    size_t    count;          /* number of openings (açıklık sayısı) */
+    ZeroRun  *runs;           /* grouped by opening, raster order within (açıklığa göre gruplu) */
+    size_t    n_runs;
+    uint32_t *edges;          /* boundary cells, row-major indices (kenar hücreleri) */
+    size_t    n_edges;
+    size_t    label_cap, open_cap, runs_cap, edges_cap;
+    uint64_t *pairs;          /* scratch: edge cell and opening (geçici: kenar ve açıklık) */
+    size_t    pairs_cap;
+} Openings;
+
+/* Index b's openings; its neighbor counts must be current. False on OOM,
+   leaving o empty. Buffers are reused across calls
+   (b'nin açıklıklarını dizinle; tamponlar yeniden kullanılır) */
+bool openings_build(Openings *o, const Board *b);
+
+/* Forget the board but keep the buffers (tamponları tutarak boşalt) */
+void openings_clear(Openings *o);
+void openings_free(Openings *o);
+
+/* The opening whose zeros include (r, c), or -1 (hücrenin açıklığı ya da -1) */
+static inline long openings_at(const Openings *o, int r, int c) {
+    if (r < 0 || r >= o->rows || c < 0 || c >= o->cols) return -1;
+    return (long)o->label[(size_t)r * o->cols + c] - 1;
+}
+
+/*
+ * board_reveal through the index: a click on a zero of an opening none of
+ * whose cells is flagged and none of whose zeros is revealed opens its
+ * zeros and its boundary cells that are still closed. Anything else — another board size,
+ * a numbered cell, flags in the way — goes to board_reveal, so the result
+ * is always the same as board_reveal's, up to the order of the changes.
+ * (Bayraksız ve dokunulmamış bir açıklıkta liste açılır; aksi halde
+ *  board_reveal çağrılır. Sonuç her zaman board_reveal ile aynıdır.)
+ */
+int openings_reveal(const Openings *o, Board *b, int r, int c, ChangeSet *out);
+
+#endif
@@ -0,0 +1,122 @@
+#include "pool.h"
+#include "rng.h"
+#include "trace.h"
+
+#include <string.h>
+
+/* rows and cols in 16 bits each, mines in 32; 0 if it does not fit
+   (satır ve sütun 16, mayın 32 bit) */
+static uint64_t pack(int rows, int cols, int mines) {
+    if (rows <= 0 || cols <= 0 || mines < 0 || rows > 0xFFFF || cols > 0xFFFF) return 0;
+    return (uint64_t)rows << 48 | (uint64_t)cols << 32 | (uint32_t)mines;
+}
+
+static bool fits(const Board *b, uint64_t want) {
+    return want && pack(b->rows, b->cols, b->mines) == want;
+}
+
+/* Boards to keep ready: as many as the budget holds, at least one
+   (bütçeye sığan tahta sayısı, en az bir) */
+static uint64_t depth(uint64_t want) {
+    size_t cells = (size_t)(want >> 48) * (size_t)((want >> 32) & 0xFFFF);
+    size_t n = POOL_BUDGET / (cells ? cells : 1);
+    return n < 1 ? 1 : n > POOL_SLOTS ? POOL_SLOTS : n;
+}
+
+static bool deal(BoardPool *p, PoolSlot *s, uint64_t want) {
+    Board *b = &s->board;
+    int rows = (int)(want >> 48), cols = (int)((want >> 32) & 0xFFFF), mines = (int)(uint32_t)want;
+    openings_clear(&s->open);
+    if (!board_setup(b, rows, cols, mines)) return false;
+    b->seed = rng_stream(p->base, p->dealt++);
+    board_place_mines(b);
+    board_compute_neighbors(b);
+    Grade g;
+    s->bv = grade_board(&p->grader, b, 0, &g) ? g.value[GRADE_3BV] : 0;
+    if ((size_t)rows * cols < p->index_below) openings_build(&s->open, b);
+    return true;
+}
+
+static THREAD_RET worker(void *arg) {
+    BoardPool *p = arg;
+    while (!atomic_load(&p->stop)) {
+        uint64_t want = atomic_load(&p->want);
+        uint64_t t = atomic_load_explicit(&p->tail, memory_order_relaxed);
+        uint64_t h = atomic_load_explicit(&p->head, memory_order_acquire);
+        if (!want || t - h >= depth(want)) { event_wait(&p->wake); continue; }
+
+        /* Slot t is outside [head, tail), so the consumer cannot touch it
+           (t yuvası [head, tail) dışında, tüketici dokunamaz) */
+        PoolSlot *s = &p->slot[t % POOL_SLOTS];
+        TRACE_BEGIN("pool deal");
+        bool ok = deal(p, s, want);
+        TRACE_END("pool deal");
+        if (!ok) { event_wait(&p->wake); continue; }  /* out of memory: retry when woken (bellek yok) */
+        if (fits(&s->board, atomic_load(&p->want)))
+            atomic_store_explicit(&p->tail, t + 1, memory_order_release);
+    }
+    TRACE_THREAD_EXIT();
+    return 0;
+}
+
+bool pool_start(BoardPool *p, uint64_t base_seed, size_t index_below) {
+    memset(p, 0, sizeof *p);
+    atomic_init(&p->head, 0);
+    atomic_init(&p->tail, 0);
+    atomic_init(&p->want, 0);
+    atomic_init(&p->stop, false);
+    p->base        = base_seed;
+    p->index_below = index_below;
+    if (!event_init(&p->wake)) return false;
+    if (!thread_start(&p->thread, worker, p)) { event_free(&p->wake); return false; }
+    p->running = true;
+    return true;
+}
+
+void pool_stop(BoardPool *p) {
+    if (!p->running) return;
+    atomic_store(&p->stop, true);
+    event_set(&p->wake);
+    thread_join(p->thread);              /* finishes the deal in progress (süren dağıtımı bitirir) */
+    event_free(&p->wake);
+    for (int i = 0; i < POOL_SLOTS; i++) {
+        board_free(&p->slot[i].board);
+        openings_free(&p->slot[i].open);
+    }
+    grade_free(&p->grader);
+    p->running = false;
+}
+
+void pool_want(BoardPool *p, int rows, int cols, int mines) {
+    if (!p->running) return;
+    uint64_t want = pack(rows, cols, mines);
+    if (want == atomic_load(&p->want)) return;
+    atomic_store(&p->want, want);
+
+    /* Drop the ready boards of the old size; they are ours to drop
+       (eski boyuttaki hazır tahtaları bırak) */
+    uint64_t h = atomic_load_explicit(&p->head, memory_order_relaxed);
+    uint64_t t = atomic_load_explicit(&p->tail, memory_order_acquire);
+    while (h != t && !fits(&p->slot[h % POOL_SLOTS].board, want)) h++;
+    atomic_store_explicit(&p->head, h, memory_order_release);
+    event_set(&p->wake);
+}
+
+bool pool_take(BoardPool *p, int rows, int cols, int mines, Board *b, Openings *o, uint32_t *bv) {
+    if (!p->running) return false;
+    uint64_t want = pack(rows, cols, mines);
+    uint64_t h = atomic_load_explicit(&p->head, memory_order_relaxed);
+    uint64_t t = atomic_load_explicit(&p->tail, memory_order_acquire);
+    bool got = false;
+    for (; h != t && !got; h++) {
+        PoolSlot *s = &p->slot[h % POOL_SLOTS];
+        if (!fits(&s->board, want)) continue;         /* dealt just before a size change (boyut değişmeden önce) */
+        Board    tb = *b; *b = s->board; s->board = tb;
+        Openings to = *o; *o = s->open;  s->open  = to;
+        *bv = s->bv;
+        got = true;
+    }
+    atomic_store_explicit(&p->head, h, memory_order_release);
+    event_set(&p->wake);
+    return got;
+}
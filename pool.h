@@ -0,0 +1,77 @@
+/*
+ * pool.h — boards dealt ahead of time (önceden dağıtılmış tahtalar)
+ *
+ * A background worker keeps a few boards for the wanted size dealt,
+ * counted, graded for 3BV (grade.h) and, when small enough, indexed
+ * (openings.h), so starting a game is a swap of two structs instead of a
+ * deal. The boards sit in a
+ * single-producer / single-consumer ring: the worker publishes a slot
+ * by advancing `tail`, the game takes one by advancing `head`, and
+ * neither ever waits for the other. The worker sleeps on an event while
+ * the ring is full and is woken by every take and every change of size.
+ *
+ * Taking swaps the caller's board into the slot, so the worker frees or
+ * reuses the old game's memory off the caller's thread. Boards are dealt
+ * from rng_stream(base, k), one k per board, so each is still fully given
+ * by its seed.
+ *
+ * (Arka plan işçisi istenen boyutta birkaç tahtayı dağıtılmış halde tutar;
+ *  oyun başlatmak bir takastır. Tahtalar tek üretici / tek tüketici
+ *  halkasındadır, kimse diğerini beklemez. Alınan yuvaya eski tahta
+ *  konur, belleğini işçi serbest bırakır.)
+ */
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "grade.h"
+#include "openings.h"
+#include "thread.h"
+
+#define POOL_SLOTS  4                          /* ring size, a power of two (halka boyutu) */
+#define POOL_BUDGET ((size_t)256 << 20)        /* bytes of cells kept ready (hazır tutulan hücre baytı) */
+
+typedef struct PoolSlot {
+    Board    board;
+    Openings open;
+    uint32_t bv;                               /* 3BV, 0 if grading ran out of memory (3BV, bellek yoksa 0) */
+} PoolSlot;
+
+typedef struct BoardPool {
+    PoolSlot             slot[POOL_SLOTS];
+    atomic_uint_fast64_t head;                 /* boards taken, consumer only (alınan tahtalar) */
+    atomic_uint_fast64_t tail;                 /* boards published, worker only (yayımlanan tahtalar) */
+    atomic_uint_fast64_t want;                 /* packed rows/cols/mines, 0 = idle (istenen boyut) */
+    atomic_bool          stop;
+    uint64_t             base, dealt;          /* seeds, worker only (tohumlar) */
+    size_t               index_below;          /* index boards under this many cells (dizin sınırı) */
+    Grader               grader;               /* worker only (yalnızca işçi) */
+    ThreadEvent          wake;
+    Thread               thread;
+    bool                 running;
+} BoardPool;
+
+/* Start the worker, idle until pool_want; false if it could not start,
+   and every pool_take then fails (işçiyi başlat) */
+bool pool_start(BoardPool *p, uint64_t base_seed, size_t index_below);
+void pool_stop(BoardPool *p);
+
+/* Keep boards of this size ready, dropping any of another size; rows 0
+   makes the worker idle. Consumer thread only (bu boyutta tahta hazırla) */
+void pool_want(BoardPool *p, int rows, int cols, int mines);
+
+/* Swap a ready board of this size, with its index, into b and o and set
+   *bv to its 3BV; false if none is ready. Consumer thread only
+   (hazır tahtayı b ve o ile takasla) */
+bool pool_take(BoardPool *p, int rows, int cols, int mines, Board *b, Openings *o, uint32_t *bv);
+
+/* Boards published and not yet taken (hazır bekleyen tahtalar) */
+static inline uint64_t pool_ready(BoardPool *p) {
+    return atomic_load(&p->tail) - atomic_load(&p->head);
+}
+
+#endif
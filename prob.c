@@ -0,0 +1,688 @@
+#include "prob.h"
+#include "thread.h"
+
+#include <limits.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_WORKERS 64
+#define PAR_MIN     16        /* smaller components are not worth a thread (küçük bileşene iş parçacığı yok) */
+
+void prob_free(ProbEngine *e) {
+    solver_free(&e->solver);
+    free(e->lfact);
+    e->lfact   = NULL;
+    e->lfact_n = 0;
+}
+
+/* ── Binomial weights (Binom ağırlıkları) ────────────────────────────── */
+static bool cache_lfact(ProbEngine *e, int n) {
+    if (e->lfact && e->lfact_n >= n) return true;
+    double *t = realloc(e->lfact, ((size_t)n + 1) * sizeof *t);
+    if (!t) return false;
+    t[0] = 0;
+    for (int k = 1; k <= n; k++) t[k] = t[k - 1] + log((double)k);
+    e->lfact   = t;
+    e->lfact_n = n;
+    return true;
+}
+
+static double log_choose(const ProbEngine *e, int n, int k) {
+    return e->lfact[n] - e->lfact[k] - e->lfact[n - k];
+}
+
+/* ── Components (Bileşenler) ─────────────────────────────────────────── */
+/*
+ * One component: its cells (vars) in breadth-first order so constraints
+ * close early in the search, the constraints over them in CSR form, and
+ * the counts the enumeration produces — ways[k] layouts with k mines and
+ * hits[v][k] of those with a mine on var v.
+ * (Bir bileşen: genişlik öncelikli sırada hücreler, kısıtlar ve sayım.)
+ */
+typedef struct {
+    int     nv, nc;
+    int    *cell;             /* board index of each var (hücre indeksi) */
+    int    *rem;              /* mines each constraint still needs (kısıtın kalan mayını) */
+    int    *con_start, *con_var;     /* vars of constraint c (kısıtın hücreleri) */
+    int    *var_start, *var_con;     /* constraints of var v (hücrenin kısıtları) */
+    int     cap;              /* no layout may use more mines than are left (üst sınır) */
+    double *ways;             /* [nv + 1] */
+    double *hits;             /* [nv][nv + 1] */
+} Comp;
+
+typedef struct {
+    const Comp *c;
+    int        *mines, *open; /* per constraint: mines placed, vars unassigned (yerleşen, atanmamış) */
+    int        *mined;        /* vars holding a mine, as a stack (mayınlı hücreler yığını) */
+    int         k;
+} Enum;
+
+static void dfs(Enum *en, int pos) {
+    const Comp *c = en->c;
+    if (pos == c->nv) {
+        c->ways[en->k] += 1;
+        for (int i = 0; i < en->k; i++) c->hits[(size_t)en->mined[i] * (c->nv + 1) + en->k] += 1;
+        return;
+    }
+    const int *cons = c->var_con + c->var_start[pos];
+    int ncons = c->var_start[pos + 1] - c->var_start[pos];
+    for (int x = 0; x <= 1; x++) {
+        if (x && en->k == c->cap) break;
+        bool ok = true;
+        for (int j = 0; j < ncons; j++) {
+            int q = cons[j];
+            en->mines[q] += x;
+            en->open[q]--;
+            if (en->mines[q] > c->rem[q] || en->mines[q] + en->open[q] < c->rem[q]) ok = false;
+        }
+        if (ok) {
+            if (x) en->mined[en->k++] = pos;
+            dfs(en, pos + 1);
+            if (x) en->k--;
+        }
+        for (int j = 0; j < ncons; j++) { en->mines[cons[j]] -= x; en->open[cons[j]]++; }
+    }
+}
+
+/* Count every layout of a small component one by one (küçük bileşeni tek tek say) */
+static bool enumerate(const Comp *c) {
+    Enum en = {c, calloc((size_t)c->nc, sizeof(int)), calloc((size_t)c->nc, sizeof(int)),
+               calloc((size_t)c->nv, sizeof(int)), 0};
+    if (!en.mines || !en.open || !en.mined) { free(en.mines); free(en.open); free(en.mined); return false; }
+    for (int q = 0; q < c->nc; q++) en.open[q] = c->con_start[q + 1] - c->con_start[q];
+    dfs(&en, 0);
+    free(en.mines); free(en.open); free(en.mined);
+    return true;
+}
+
+/* ── Counting across a cut (Kesit üzerinden sayma) ───────────────────── */
+/*
+ * Enumeration visits every layout, and a long frontier has astronomically
+ * many. Vars are assigned in breadth-first order instead, and after var p
+ * all that matters for the rest is how many mines each constraint that
+ * straddles the cut already holds. Layouts that agree on those counts are
+ * merged: a forward pass keeps, per cut state, the number of ways to
+ * reach it with k mines; a backward pass the number of ways to finish.
+ * hits[p][k] joins the two across var p. Cost grows with the number of
+ * distinct cut states, not with the number of layouts.
+ *
+ * (Düzenleri tek tek saymak yerine: p. hücreden sonra yalnızca kesiti
+ *  geçen kısıtların mayın sayıları önemlidir. Aynı sayılara ulaşan
+ *  düzenler birleşir; ileri geçiş oraya k mayınla varış yollarını, geri
+ *  geçiş bitirme yollarını sayar.)
+ */
+#define CUT_MAX 32            /* constraints across a cut, 4 bits each (kesitteki kısıt, 4'er bit) */
+
+typedef struct {
+    uint64_t key[2];          /* mines held by each constraint across the cut (kesit durumu) */
+    int      lo, hi;          /* k range of the forward counts (ileri sayımın k aralığı) */
+    size_t   off;             /* counts live at arena[off …] (sayımlar) */
+    int      to[2];           /* entry after var p = 0 / 1, -1 if invalid (sonraki durum) */
+} CutEntry;
+
+typedef struct {
+    CutEntry *e;
+    int       n, cap;
+    int      *slot;           /* open addressing, -1 = empty (açık adresleme) */
+    size_t    mask;
+} Cut;
+
+static inline int key_get(const uint64_t *key, int j) {
+    return (int)(key[j >> 4] >> ((j & 15) * 4)) & 15;
+}
+
+static inline size_t key_hash(const uint64_t *key) {
+    uint64_t h = key[0] * 0x9E3779B97F4A7C15ull ^ key[1];
+    return (size_t)(h ^ (h >> 29) ^ (h >> 47));
+}
+
+static void cut_free(Cut *c) {
+    free(c->e);
+    free(c->slot);
+    memset(c, 0, sizeof *c);
+}
+
+/* Index of the entry with this key, inserted if new; -1 on OOM (anahtarın girdisi) */
+static int cut_find(Cut *c, const uint64_t *key) {
+    if ((size_t)c->n * 2 >= c->mask + 1 || !c->slot) {
+        size_t size = c->slot ? (c->mask + 1) * 2 : 64;
+        int *slot = malloc(size * sizeof *slot);
+        if (!slot) return -1;
+        for (size_t i = 0; i < size; i++) slot[i] = -1;
+        for (int i = 0; i < c->n; i++) {
+            size_t h = key_hash(c->e[i].key) & (size - 1);
+            while (slot[h] >= 0) h = (h + 1) & (size - 1);
+            slot[h] = i;
+        }
+        free(c->slot);
+        c->slot = slot;
+        c->mask = size - 1;
+    }
+    size_t h = key_hash(key) & c->mask;
+    for (; c->slot[h] >= 0; h = (h + 1) & c->mask) {
+        const CutEntry *e = &c->e[c->slot[h]];
+        if (e->key[0] == key[0] && e->key[1] == key[1]) return c->slot[h];
+    }
+    if (c->n == c->cap) {
+        int cap = c->cap ? c->cap * 2 : 64;
+        CutEntry *e = realloc(c->e, (size_t)cap * sizeof *e);
+        if (!e) return -1;
+        c->e = e; c->cap = cap;
+    }
+    CutEntry *e = &c->e[c->n];
+    e->key[0] = key[0]; e->key[1] = key[1];
+    e->lo = INT_MAX; e->hi = -1;
+    e->to[0] = e->to[1] = -1;
+    c->slot[h] = c->n;
+    return c->n++;
+}
+
+/*
+ * Returns 1 when counted, 0 when a cut is wider than CUT_MAX (the caller
+ * falls back to enumeration), -1 on OOM.
+ * (Sayıldıysa 1, kesit çok genişse 0, bellek yetmezse -1.)
+ */
+static int count_across_cuts(const Comp *c) {
+    const int nv = c->nv, nc = c->nc;
+    int ret = -1, width = 0;
+    int *first = malloc((size_t)nc * sizeof *first), *last = malloc((size_t)nc * sizeof *last);
+    int *act_start = malloc(((size_t)nv + 2) * sizeof *act_start);
+    int *where = malloc((size_t)nc * sizeof *where);
+    Cut *cuts = calloc((size_t)nv + 1, sizeof *cuts);
+    double *arena = NULL, *bnext = NULL, *bcur = NULL;
+    int *act = NULL;
+    if (!first || !last || !act_start || !where || !cuts) goto done;
+
+    for (int q = 0; q < nc; q++) {
+        first[q] = INT_MAX; last[q] = -1;
+        for (int j = c->con_start[q]; j < c->con_start[q + 1]; j++) {
+            int v = c->con_var[j];
+            if (v < first[q]) first[q] = v;
+            if (v > last[q])  last[q]  = v;
+        }
+    }
+    /* Constraints across cut p — after vars 0 … p-1 (p. kesiti geçen kısıtlar) */
+    act_start[0] = 0;
+    for (int p = 0; p <= nv; p++) {
+        int w = 0;
+        for (int q = 0; q < nc; q++) w += first[q] < p && p <= last[q];
+        if (w > width) width = w;
+        act_start[p + 1] = act_start[p] + w;
+    }
+    if (width > CUT_MAX) { ret = 0; goto done; }
+    act = malloc(((size_t)act_start[nv + 1] + 1) * sizeof *act);
+    if (!act) goto done;
+    for (int p = 0, n = 0; p <= nv; p++)
+        for (int q = 0; q < nc; q++)
+            if (first[q] < p && p <= last[q]) act[n++] = q;
+
+    /* Forward (ileri) */
+    size_t used = 1, room = 1024;
+    arena = malloc(room * sizeof *arena);
+    uint64_t zero[2] = {0, 0};
+    if (!arena || cut_find(&cuts[0], zero) < 0) goto done;
+    cuts[0].e[0].lo = cuts[0].e[0].hi = 0;
+    cuts[0].e[0].off = 0;
+    arena[0] = 1;
+
+    for (int p = 0; p < nv; p++) {
+        Cut *from = &cuts[p], *to = &cuts[p + 1];
+        const int *a0 = act + act_start[p], *a1 = act + act_start[p + 1];
+        int w0 = act_start[p + 1] - act_start[p], w1 = act_start[p + 2] - act_start[p + 1];
+        for (int q = 0; q < nc; q++) where[q] = -1;
+        for (int j = 0; j < w0; j++) where[a0[j]] = j;
+        const int *cons = c->var_con + c->var_start[p];
+        int ncons = c->var_start[p + 1] - c->var_start[p];
+
+        for (int i = 0; i < from->n; i++) {
+            CutEntry *e = &from->e[i];
+            for (int x = 0; x <= 1; x++) {
+                if (e->lo + x > c->cap) continue;
+                /* Constraints on var p stay within reach (p'nin kısıtları tutarlı mı) */
+                bool ok = true;
+                for (int t = 0; t < ncons && ok; t++) {
+                    int q = cons[t];
+                    int held = (where[q] >= 0 ? key_get(e->key, where[q]) : 0) + x, after = 0;
+                    for (int j = c->con_start[q]; j < c->con_start[q + 1]; j++) after += c->con_var[j] > p;
+                    ok = held <= c->rem[q] && held + after >= c->rem[q];
+                }
+                if (!ok) continue;
+                uint64_t key[2] = {0, 0};
+                for (int j = 0; j < w1; j++) {
+                    int q = a1[j], held = where[q] >= 0 ? key_get(e->key, where[q]) : 0;
+                    for (int t = 0; t < ncons; t++) held += x && cons[t] == q;
+                    key[j >> 4] |= (uint64_t)held << ((j & 15) * 4);
+                }
+                int k = cut_find(to, key);
+                if (k < 0) goto done;
+                e = &from->e[i];
+                e->to[x] = k;
+                CutEntry *n = &to->e[k];
+                if (e->lo + x < n->lo) n->lo = e->lo + x;
+                int hi = e->hi + x > c->cap ? c->cap : e->hi + x;
+                if (hi > n->hi) n->hi = hi;
+            }
+        }
+        /* Lay out and fill the next cut's counts (sonraki kesitin sayımları) */
+        for (int k = 0; k < to->n; k++) {
+            to->e[k].off = used;
+            used += (size_t)(to->e[k].hi - to->e[k].lo + 1);
+        }
+        if (used > room) {
+            while (room < used) room *= 2;
+            double *grown = realloc(arena, room * sizeof *arena);
+            if (!grown) goto done;
+            arena = grown;
+        }
+        for (int k = 0; k < to->n; k++)
+            memset(arena + to->e[k].off, 0, (size_t)(to->e[k].hi - to->e[k].lo + 1) * sizeof *arena);
+        for (int i = 0; i < from->n; i++) {
+            const CutEntry *e = &from->e[i];
+            for (int x = 0; x <= 1; x++) {
+                if (e->to[x] < 0) continue;
+                const CutEntry *n = &to->e[e->to[x]];
+                for (int k = e->lo; k <= e->hi && k + x <= n->hi; k++)
+                    arena[n->off + (size_t)(k + x - n->lo)] += arena[e->off + (size_t)(k - e->lo)];
+            }
+        }
+    }
+    if (cuts[nv].n == 1) {
+        const CutEntry *e = &cuts[nv].e[0];
+        for (int k = e->lo; k <= e->hi; k++) c->ways[k] = arena[e->off + (size_t)(k - e->lo)];
+    }
+
+    /* Backward, joining hits across each var (geri geçiş, isabetler) */
+    int stride = nv + 1;
+    bnext = calloc((size_t)cuts[nv].n * stride + 1, sizeof *bnext);
+    if (!bnext) goto done;
+    if (cuts[nv].n == 1) bnext[0] = 1;
+    for (int p = nv - 1; p >= 0; p--) {
+        const Cut *from = &cuts[p];
+        bcur = calloc((size_t)from->n * stride + 1, sizeof *bcur);
+        if (!bcur) goto done;
+        double *h = c->hits + (size_t)p * stride;
+        for (int i = 0; i < from->n; i++) {
+            const CutEntry *e = &from->e[i];
+            double *b = bcur + (size_t)i * stride;
+            for (int x = 0; x <= 1; x++) {
+                if (e->to[x] < 0) continue;
+                const double *bn = bnext + (size_t)e->to[x] * stride;
+                for (int k2 = 0; k2 + x <= nv - p; k2++) {
+                    if (bn[k2] == 0) continue;
+                    b[k2 + x] += bn[k2];
+                    if (!x) continue;
+                    for (int k1 = e->lo; k1 <= e->hi && k1 + 1 + k2 <= c->cap; k1++)
+                        h[k1 + 1 + k2] += arena[e->off + (size_t)(k1 - e->lo)] * bn[k2];
+                }
+            }
+        }
+        free(bnext);
+        bnext = bcur;
+        bcur = NULL;
+    }
+    ret = 1;
+done:
+    if (cuts) for (int p = 0; p <= nv; p++) cut_free(&cuts[p]);
+    free(first); free(last); free(act_start); free(where); free(cuts);
+    free(act); free(arena); free(bnext); free(bcur);
+    return ret;
+}
+
+#define ENUM_MAX 16           /* up to this many vars, plain enumeration is cheaper (bu boyuta dek düz sayım) */
+
+static bool count_component(const Comp *c) {
+    if (c->nv > ENUM_MAX) {
+        int r = count_across_cuts(c);
+        if (r) return r > 0;
+    }
+    return enumerate(c);
+}
+
+typedef struct {
+    Comp       *comps;
+    int         n;
+    atomic_int  next;
+    atomic_bool oom;
+} Pool;
+
+static THREAD_RET enum_worker(void *arg) {
+    Pool *pl = arg;
+    for (int i; (i = atomic_fetch_add(&pl->next, 1)) < pl->n; )
+        if (!count_component(&pl->comps[i])) atomic_store(&pl->oom, true);
+    return 0;
+}
+
+/* ── Building (Kurulum) ──────────────────────────────────────────────── */
+static int uf_find(int *parent, int x) {
+    while (parent[x] != x) x = parent[x] = parent[parent[x]];
+    return x;
+}
+
+static int by_size_desc(const void *a, const void *b) {
+    return ((const Comp *)b)->nv - ((const Comp *)a)->nv;
+}
+
+static void free_comps(Comp *comps, int n) {
+    for (int i = 0; i < n; i++) {
+        free(comps[i].cell);    free(comps[i].rem);
+        free(comps[i].con_start); free(comps[i].con_var);
+        free(comps[i].var_start); free(comps[i].var_con);
+        free(comps[i].ways);    free(comps[i].hits);
+    }
+    free(comps);
+}
+
+/*
+ * Frontier vars and the constraints over them are collected board-wide,
+ * joined with union-find, then copied out per component with vars
+ * renumbered in breadth-first order.
+ * (Sınır hücreleri ve kısıtlar toplanır, birleşim-bul ile gruplanır, her
+ *  bileşen genişlik öncelikli sırayla kopyalanır.)
+ */
+static Comp *build_components(const Solver *s, const Board *b, int *var_of, int nv,
+                              int cap, int *ncomp) {
+    const int R = b->rows, C = b->cols;
+    int nc = 0, n = 0;
+    for (int r = 0; r < R; r++)
+        for (int c = 0; c < C; c++)
+            if (solver_state(s, r, c) == SOLVER_OPEN) nc++;
+
+    /* Constraints, CSR over global var numbers (kısıtlar, genel numaralarla) */
+    int *rem = malloc(((size_t)nc + 1) * sizeof *rem), *cstart = malloc(((size_t)nc + 1) * sizeof *cstart);
+    int *cvar = malloc(((size_t)nc * 8 + 1) * sizeof *cvar), *parent = malloc(((size_t)nv + 1) * sizeof *parent);
+    Comp *comps = NULL;
+    int *root_comp = NULL, *deg = NULL, *vstart = NULL, *vcon = NULL, *order = NULL, *local = NULL;
+    if (!rem || !cstart || !cvar || !parent) goto done;
+    for (int v = 0; v < nv; v++) parent[v] = v;
+
+    nc = 0;
+    cstart[0] = 0;
+    for (int r = 0; r < R; r++)
+        for (int c = 0; c < C; c++) {
+            if (solver_state(s, r, c) != SOLVER_OPEN) continue;
+            int need = board_cell(b, r, c) & CELL_COUNT, len = cstart[nc];
+            for (int dr = -1; dr <= 1; dr++)
+                for (int dc = -1; dc <= 1; dc++) {
+                    int rr = r + dr, cc = c + dc;
+                    if ((!dr && !dc) || rr < 0 || rr >= R || cc < 0 || cc >= C) continue;
+                    int st = solver_state(s, rr, cc);
+                    if (st == SOLVER_MINE) need--;
+                    else if (st == SOLVER_CLOSED) cvar[len++] = var_of[rr * C + cc];
+                }
+            if (len == cstart[nc]) continue;    /* nothing closed around it (çevresi kapalı değil) */
+            for (int j = cstart[nc] + 1; j < len; j++) {
+                int a = uf_find(parent, cvar[cstart[nc]]), z = uf_find(parent, cvar[j]);
+                if (a != z) parent[a] = z;
+            }
+            rem[nc] = need;
+            cstart[++nc] = len;
+        }
+
+    /* Component ids (bileşen numaraları) */
+    root_comp = malloc(((size_t)nv + 1) * sizeof *root_comp);
+    if (!root_comp) goto done;
+    for (int v = 0; v < nv; v++) root_comp[v] = -1;
+    for (int v = 0; v < nv; v++) {
+        int rt = uf_find(parent, v);
+        if (root_comp[rt] < 0) root_comp[rt] = n++;
+    }
+    comps = calloc((size_t)n ? (size_t)n : 1, sizeof *comps);
+    if (!comps) goto done;
+
+    /* var → constraints, global CSR (hücre → kısıtlar) */
+    deg = calloc((size_t)nv + 1, sizeof *deg);
+    vstart = malloc(((size_t)nv + 1) * sizeof *vstart);
+    vcon = malloc(((size_t)cstart[nc] + 1) * sizeof *vcon);
+    order = malloc(((size_t)nv + 1) * sizeof *order);
+    local = malloc(((size_t)nv + 1) * sizeof *local);
+    if (!deg || !vstart || !vcon || !order || !local) goto fail;
+    for (int j = 0; j < cstart[nc]; j++) deg[cvar[j]]++;
+    vstart[0] = 0;
+    for (int v = 0; v < nv; v++) vstart[v + 1] = vstart[v] + deg[v];
+    for (int v = 0; v < nv; v++) deg[v] = vstart[v];
+    for (int q = 0; q < nc; q++)
+        for (int j = cstart[q]; j < cstart[q + 1]; j++) vcon[deg[cvar[j]]++] = q;
+
+    for (int v = 0; v < nv; v++) { comps[root_comp[uf_find(parent, v)]].nv++; local[v] = -1; }
+    for (int q = 0; q < nc; q++) comps[root_comp[uf_find(parent, cvar[cstart[q]])]].nc++;
+
+    for (int i = 0; i < n; i++) {
+        Comp *k = &comps[i];
+        k->cap       = cap;
+        k->cell      = malloc((size_t)k->nv * sizeof *k->cell);
+        k->rem       = malloc((size_t)k->nc * sizeof *k->rem);
+        k->con_start = malloc(((size_t)k->nc + 1) * sizeof *k->con_start);
+        k->con_var   = malloc((size_t)k->nc * 8 * sizeof *k->con_var);
+        k->var_start = malloc(((size_t)k->nv + 1) * sizeof *k->var_start);
+        k->var_con   = malloc((size_t)k->nc * 8 * sizeof *k->var_con);
+        k->ways      = calloc((size_t)k->nv + 1, sizeof *k->ways);
+        k->hits      = calloc((size_t)k->nv * (k->nv + 1), sizeof *k->hits);
+        if (!k->cell || !k->rem || !k->con_start || !k->con_var || !k->var_start || !k->var_con
+            || !k->ways || !k->hits) goto fail;
+        k->nv = k->nc = 0;                      /* refilled below (aşağıda yeniden dolar) */
+    }
+
+    /* Breadth-first renumbering per component (bileşen başına BFS numaralama) */
+    for (int v0 = 0; v0 < nv; v0++) {
+        if (local[v0] >= 0) continue;
+        Comp *k = &comps[root_comp[uf_find(parent, v0)]];
+        int head = 0, tail = 0;
+        order[tail++] = v0;
+        local[v0] = k->nv++;
+        while (head < tail) {
+            int v = order[head++];
+            for (int j = vstart[v]; j < vstart[v + 1]; j++) {
+                int q = vcon[j];
+                for (int t = cstart[q]; t < cstart[q + 1]; t++) {
+                    int u = cvar[t];
+                    if (local[u] < 0) { local[u] = k->nv++; order[tail++] = u; }
+                }
+            }
+        }
+    }
+    for (int idx = 0; idx < R * C; idx++)
+        if (var_of[idx] >= 0) comps[root_comp[uf_find(parent, var_of[idx])]].cell[local[var_of[idx]]] = idx;
+
+    /* Constraints per component, vars in local numbering (yerel numaralı kısıtlar) */
+    for (int i = 0; i < n; i++) comps[i].con_start[0] = 0;
+    for (int q = 0; q < nc; q++) {
+        Comp *k = &comps[root_comp[uf_find(parent, cvar[cstart[q]])]];
+        int len = k->con_start[k->nc];
+        for (int t = cstart[q]; t < cstart[q + 1]; t++) k->con_var[len++] = local[cvar[t]];
+        k->rem[k->nc] = rem[q];
+        k->con_start[++k->nc] = len;
+    }
+    for (int i = 0; i < n; i++) {
+        Comp *k = &comps[i];
+        memset(k->var_start, 0, ((size_t)k->nv + 1) * sizeof *k->var_start);
+        for (int j = 0; j < k->con_start[k->nc]; j++) k->var_start[k->con_var[j] + 1]++;
+        for (int v = 0; v < k->nv; v++) k->var_start[v + 1] += k->var_start[v];
+        int *fill = order;                      /* reuse as cursor (imleç olarak) */
+        for (int v = 0; v < k->nv; v++) fill[v] = k->var_start[v];
+        for (int q = 0; q < k->nc; q++)
+            for (int j = k->con_start[q]; j < k->con_start[q + 1]; j++) k->var_con[fill[k->con_var[j]]++] = q;
+    }
+    *ncomp = n;
+    goto done;
+
+fail:
+    free_comps(comps, n);
+    comps = NULL;
+done:
+    free(rem); free(cstart); free(cvar); free(parent);
+    free(root_comp); free(deg); free(vstart); free(vcon); free(order); free(local);
+    return comps;
+}
+
+/* ── Combination (Birleştirme) ───────────────────────────────────────── */
+static void normalize(double *a, int n) {
+    double m = 0;
+    for (int i = 0; i < n; i++) if (a[i] > m) m = a[i];
+    if (m > 0) for (int i = 0; i < n; i++) a[i] /= m;
+}
+
+/*
+ * With ways_c(k) per component and w(j) = C(interior, left - j) for j
+ * frontier mines in total, the weight of component c having k mines is
+ *     T_c(k) = Σ_p P_c(p) · G_{c+1}(k + p)
+ * where P_c is the convolution of components before c and G_{c+1}(j)
+ * folds the components after c into w:
+ *     G_n(j) = w(j),  G_c(j) = Σ_k ways_c(k) · G_{c+1}(j + k).
+ * Both sweeps are O(frontier²). Any rescaling of P_c or G_c cancels in
+ * the ratio, so each is normalized to keep the doubles in range.
+ * (Bileşen c'nin k mayınlı ağırlığı, öncekilerin evrişimi P_c ve
+ *  sonrakileri w'ye katlayan G_{c+1} ile hesaplanır; her ikisi de O(sınır²).)
+ */
+static bool combine(const ProbEngine *e, Comp *comps, int n, int L, int interior, int left,
+                    double *p, double *p_interior) {
+    bool ok = false;
+    double *G = malloc(((size_t)n + 1) * (L + 1) * sizeof *G);
+    double *P = calloc((size_t)L + 1, sizeof *P), *Pn = malloc(((size_t)L + 1) * sizeof *Pn);
+    double *T = malloc(((size_t)L + 1) * sizeof *T);
+    if (!G || !P || !Pn || !T) goto done;
+
+    /* w(j), normalized over the feasible range (uygulanabilir aralıkta ağırlık) */
+    double *w = G + (size_t)n * (L + 1), top = -INFINITY;
+    for (int j = 0; j <= L; j++) {
+        int m = left - j;
+        if (m >= 0 && m <= interior) { double l = log_choose(e, interior, m); if (l > top) top = l; }
+    }
+    if (top == -INFINITY) goto done;
+    for (int j = 0; j <= L; j++) {
+        int m = left - j;
+        w[j] = (m >= 0 && m <= interior) ? exp(log_choose(e, interior, m) - top) : 0;
+    }
+
+    for (int c = n - 1; c >= 0; c--) {
+        const double *next = G + (size_t)(c + 1) * (L + 1);
+        double *g = G + (size_t)c * (L + 1);
+        for (int j = 0; j <= L; j++) {
+            double sum = 0;
+            for (int k = 0; k <= comps[c].nv && j + k <= L; k++) sum += comps[c].ways[k] * next[j + k];
+            g[j] = sum;
+        }
+        normalize(g, L + 1);
+    }
+
+    int plen = 1;
+    P[0] = 1;
+    for (int c = 0; c < n; c++) {
+        const Comp *k = &comps[c];
+        const double *next = G + (size_t)(c + 1) * (L + 1);
+        double z = 0;
+        for (int m = 0; m <= k->nv; m++) {
+            double t = 0;
+            for (int q = 0; q < plen && m + q <= L; q++) t += P[q] * next[m + q];
+            T[m] = t;
+            z += k->ways[m] * t;
+        }
+        if (z <= 0) goto done;
+        for (int v = 0; v < k->nv; v++) {
+            const double *h = k->hits + (size_t)v * (k->nv + 1);
+            double num = 0;
+            for (int m = 0; m <= k->nv; m++) num += h[m] * T[m];
+            p[k->cell[v]] = num / z;
+        }
+        /* P_{c+1} = P_c * ways_c (evrişim) */
+        int nlen = plen + k->nv;
+        for (int q = 0; q < nlen; q++) Pn[q] = 0;
+        for (int q = 0; q < plen; q++)
+            for (int m = 0; m <= k->nv; m++) Pn[q + m] += P[q] * k->ways[m];
+        normalize(Pn, nlen);
+        double *t = P; P = Pn; Pn = t;
+        plen = nlen;
+    }
+
+    /* Interior: expected mines left over, shared evenly (iç hücreler) */
+    double z = 0, mines = 0;
+    for (int j = 0; j < plen; j++) {
+        z     += P[j] * w[j];
+        mines += P[j] * w[j] * (left - j);
+    }
+    if (z <= 0) goto done;
+    *p_interior = interior ? mines / z / interior : 0;
+    ok = true;
+done:
+    free(G); free(P); free(Pn); free(T);
+    return ok;
+}
+
+/* ── Entry point (Giriş noktası) ─────────────────────────────────────── */
+#define INTERIOR (-2)
+
+bool prob_compute(ProbEngine *e, const Board *b, bool trust_flags, double *p, ProbStats *st) {
+    const int R = b->rows, C = b->cols, N = R * C;
+    Solver *s = &e->solver;
+    int decided = solver_deduce(s, b, trust_flags);
+    if (decided < 0 || !cache_lfact(e, N)) return false;
+
+    /* Sort cells: opened, settled, frontier var or INTERIOR (hücreleri ayır) */
+    int *var_of = malloc((size_t)N * sizeof *var_of);
+    if (!var_of) return false;
+    int nv = 0, interior = 0, left = b->mines;
+    for (int r = 0; r < R; r++)
+        for (int c = 0; c < C; c++) {
+            int idx = r * C + c, st0 = solver_state(s, r, c);
+            var_of[idx] = -1;
+            p[idx] = st0 == SOLVER_MINE ? 1.0 : 0.0;
+            if (st0 == SOLVER_MINE) left--;
+            if (st0 != SOLVER_CLOSED) continue;
+            bool edge = false;
+            for (int dr = -1; dr <= 1 && !edge; dr++)
+                for (int dc = -1; dc <= 1 && !edge; dc++) {
+                    int rr = r + dr, cc = c + dc;
+                    edge = (dr || dc) && rr >= 0 && rr < R && cc >= 0 && cc < C
+                        && solver_state(s, rr, cc) == SOLVER_OPEN;
+                }
+            if (edge) var_of[idx] = nv++;
+            else { var_of[idx] = INTERIOR; interior++; }
+        }
+    int n = 0;
+    Comp *comps = left >= 0 ? build_components(s, b, var_of, nv, left, &n) : NULL;
+    if (!comps) { free(var_of); return false; }
+    qsort(comps, (size_t)n, sizeof *comps, by_size_desc);
+
+    /* Enumerate — big components in parallel (büyük bileşenler paralel) */
+    int big = 0;
+    while (big < n && comps[big].nv >= PAR_MIN) big++;
+    int threads = e->threads > 0 ? e->threads : thread_cpu_count();
+    if (threads > big) threads = big;
+    if (threads > MAX_WORKERS) threads = MAX_WORKERS;
+    Pool pool = {.comps = comps, .n = n};
+    atomic_init(&pool.next, 0);
+    atomic_init(&pool.oom, false);
+    Thread t[MAX_WORKERS];
+    int started = 0;
+    while (started < threads - 1 && thread_start(&t[started], enum_worker, &pool)) started++;
+    enum_worker(&pool);
+    for (int i = 0; i < started; i++) thread_join(t[i]);
+
+    bool ok = !atomic_load(&pool.oom);
+    for (int i = 0; ok && i < n; i++) {
+        double top = 0;
+        for (int k = 0; k <= comps[i].nv; k++) if (comps[i].ways[k] > top) top = comps[i].ways[k];
+        if (top == 0) ok = false;               /* no layout fits (uyan düzen yok) */
+        else {
+            for (int k = 0; k <= comps[i].nv; k++) comps[i].ways[k] /= top;
+            for (size_t k = 0; k < (size_t)comps[i].nv * (comps[i].nv + 1); k++) comps[i].hits[k] /= top;
+        }
+    }
+
+    double p_int = 0;
+    if (ok) ok = combine(e, comps, n, nv, interior, left, p, &p_int);
+    for (int idx = 0; ok && idx < N; idx++)
+        if (var_of[idx] == INTERIOR) p[idx] = p_int;
+    free(var_of);
+
+    if (st) {
+        st->frontier   = nv;
+        st->interior   = interior;
+        st->decided    = decided;
+        st->components = n;
+        st->largest    = n ? comps[0].nv : 0;
+    }
+    free_comps(comps, n);
+    return ok;
+}
@@ -0,0 +1,52 @@
+/*
+ * prob.h — exact mine probabilities (kesin mayın olasılıkları)
+ *
+ * For every closed cell, the fraction of all mine layouts consistent with
+ * the visible board (and the total mine count) that put a mine there.
+ * Cells next to an opened number form the frontier; it splits into
+ * components that share no number, each enumerated on its own with
+ * pruning. The closed cells away from any number (the interior) are
+ * interchangeable, so they enter only through binomial weights
+ * C(interior, mines left), computed from a cached log-factorial table.
+ * Large components are enumerated in parallel.
+ *
+ * (Her kapalı hücre için, görünen tahtayla tutarlı düzenlerin o hücreye
+ *  mayın koyan oranı. Sınır, ortak sayısı olmayan bileşenlere ayrılır ve
+ *  her biri budanarak ayrı ayrı sayılır; iç hücreler yalnızca binom
+ *  ağırlıklarıyla girer.)
+ */
+#ifndef PROB_H
+#define PROB_H
+
+#include <stdbool.h>
+
+#include "board.h"
+#include "solver.h"
+
+typedef struct ProbStats {
+    int frontier;             /* undecided cells next to a number (sınır hücreleri) */
+    int interior;             /* closed cells away from every number (iç hücreler) */
+    int decided;              /* settled by deduction before counting (çıkarımla belirlenen) */
+    int components;
+    int largest;              /* cells in the biggest component (en büyük bileşen) */
+} ProbStats;
+
+typedef struct ProbEngine {
+    int     threads;          /* 0 = one per CPU (0 = işlemci başına bir) */
+    Solver  solver;           /* settles the easy cells first (kolay hücreleri önce belirler) */
+    double *lfact;            /* log k!, k = 0 … lfact_n (log faktöriyel önbelleği) */
+    int     lfact_n;
+} ProbEngine;
+
+void prob_free(ProbEngine *e);
+
+/*
+ * Fill p[r * cols + c] with the mine probability of every cell: 0 for
+ * opened cells, 1 for proven mines. Flags count as mines only when
+ * trust_flags is set. Returns false on OOM or when no layout fits the
+ * visible state (e.g. a wrong trusted flag).
+ * (Her hücrenin mayın olasılığını p'ye yazar; açık hücreler 0.)
+ */
+bool prob_compute(ProbEngine *e, const Board *b, bool trust_flags, double *p, ProbStats *st);
+
+#endif
@@ -0,0 +1,374 @@
+#include "replay.h"
+#include "journal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define SEEK_TRIES 2          /* keyframes tried before the start (baştan önce denenen ana kareler) */
+
+/* ── Byte buffers and varints (Bayt tamponları ve varint'ler) ─────────── */
+typedef struct {
+    uint8_t *p;
+    size_t   len, cap;
+    bool     oom;
+} Buf;
+
+static void put_bytes(Buf *b, const void *src, size_t n) {
+    if (b->len + n > b->cap) {
+        size_t cap = b->cap ? b->cap : 256;
+        while (cap < b->len + n) cap *= 2;
+        uint8_t *p = realloc(b->p, cap);
+        if (!p) { b->oom = true; return; }
+        b->p = p; b->cap = cap;
+    }
+    memcpy(b->p + b->len, src, n);
+    b->len += n;
+}
+
+static void put_varint(Buf *b, uint64_t v) {
+    uint8_t tmp[10];
+    int n = 0;
+    do {
+        tmp[n] = (uint8_t)(v & 0x7F);
+        v >>= 7;
+        if (v) tmp[n] |= 0x80;
+        n++;
+    } while (v);
+    put_bytes(b, tmp, (size_t)n);
+}
+
+static bool get_varint(const uint8_t *p, size_t len, size_t *pos, uint64_t *v) {
+    *v = 0;
+    for (int shift = 0; shift < 64 && *pos < len; shift += 7) {
+        uint8_t byte = p[(*pos)++];
+        *v |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+/* ── Recording (Kayıt) ───────────────────────────────────────────────── */
+void replay_free(Replay *rp) {
+    free(rp->ev);
+    free(rp->keys);
+    free(rp->file);
+    memset(rp, 0, sizeof *rp);
+}
+
+bool replay_copy(Replay *dst, const Replay *src) {
+    memset(dst, 0, sizeof *dst);
+    if (src->oom || !(dst->ev = malloc(src->ev_len + 1))) return false;
+    memcpy(dst->ev, src->ev, src->ev_len);
+    dst->rows   = src->rows;   dst->cols   = src->cols;   dst->mines = src->mines;
+    dst->deal_r = src->deal_r; dst->deal_c = src->deal_c; dst->seed  = src->seed;
+    dst->ev_len = dst->ev_cap = src->ev_len;
+    dst->n_events = src->n_events;
+    dst->last_ms  = src->last_ms;
+    dst->outcome  = src->outcome;
+    dst->revealed = src->revealed;
+    dst->undo     = src->undo;
+    return true;
+}
+
+void replay_begin(Replay *rp, const Board *b, int deal_r, int deal_c) {
+    uint8_t *ev = rp->ev;
+    size_t   cap = rp->ev_cap;
+    free(rp->keys);
+    free(rp->file);
+    memset(rp, 0, sizeof *rp);
+    rp->ev     = ev;              /* keep the buffer across games (tampon oyunlar arası kalır) */
+    rp->ev_cap = cap;
+    rp->rows   = b->rows;
+    rp->cols   = b->cols;
+    rp->mines  = b->mines;
+    rp->seed   = b->seed;
+    rp->deal_r = deal_r;
+    rp->deal_c = deal_c;
+}
+
+void replay_record(Replay *rp, int type, int r, int c, uint64_t t_ms) {
+    Buf b = {rp->ev, rp->ev_len, rp->ev_cap, false};
+    uint64_t dt = t_ms >= rp->last_ms ? t_ms - rp->last_ms : 0;
+    put_varint(&b, dt << 2 | (uint64_t)type);
+    put_varint(&b, (uint64_t)r * (uint64_t)rp->cols + (uint64_t)c);
+    rp->ev = b.p; rp->ev_len = b.len; rp->ev_cap = b.cap;
+    if (b.oom) { rp->oom = true; return; }
+    if (type == REPLAY_UNDO || type == REPLAY_REDO) rp->undo = true;
+    if (t_ms > rp->last_ms) rp->last_ms = t_ms;
+    rp->n_events++;
+}
+
+void replay_finish(Replay *rp, const Board *b) {
+    rp->outcome  = b->exploded ? REPLAY_LOST : board_won(b) ? REPLAY_WON : REPLAY_PLAYING;
+    rp->revealed = b->revealed_count;
+}
+
+bool replay_adopt_flags(Replay *rp, Board *b, Journal *j) {
+    /* Take the journaled flags still set off the board, once each
+       (hâlâ dikili bayrakları birer kez kaldır) */
+    uint32_t *cell = j->top_cell ? malloc(j->top_cell * sizeof *cell) : NULL;
+    size_t n = 0;
+    bool ok = !j->top_cell || cell;
+    for (size_t i = 0; i < j->top_cell; i++) {
+        int r = (int)(j->cells[i] / (uint32_t)b->cols), c = (int)(j->cells[i] % (uint32_t)b->cols);
+        if (!board_flagged(b, r, c)) continue;
+        board_toggle_flag(b, r, c, NULL);
+        if (cell) cell[n++] = j->cells[i];
+    }
+    journal_clear(j);
+    /* Plant them again as events at the deal (dağıtımda yeniden dik) */
+    ChangeSet cs = {0};
+    for (size_t i = 0; i < n; i++) {
+        int r = (int)(cell[i] / (uint32_t)b->cols), c = (int)(cell[i] % (uint32_t)b->cols);
+        changes_clear(&cs);
+        board_toggle_flag(b, r, c, &cs);
+        journal_push(j, b, JOURNAL_FLAG, &cs);
+        replay_record(rp, REPLAY_FLAG, r, c, 0);
+    }
+    changes_free(&cs);
+    free(cell);
+    return ok;
+}
+
+/* ── Playback (Oynatma) ──────────────────────────────────────────────── */
+bool replay_next(const Replay *rp, size_t *offset, uint64_t *t_ms, ReplayEvent *ev) {
+    uint64_t head, cell;
+    if (!get_varint(rp->ev, rp->ev_len, offset, &head) || !get_varint(rp->ev, rp->ev_len, offset, &cell))
+        return false;
+    if (cell >= (uint64_t)rp->rows * (uint64_t)rp->cols) return false;
+    *t_ms += head >> 2;
+    ev->type = (int)(head & 3);
+    ev->r    = (int)(cell / (uint64_t)rp->cols);
+    ev->c    = (int)(cell % (uint64_t)rp->cols);
+    ev->t_ms = *t_ms;
+    return true;
+}
+
+/* One event; logs with undo keep a journal j, fed through cs. False
+   when an undo or redo found nothing in j to act on
+   (olayı uygula; geri alma içeren kayıtlar günlük tutar) */
+static bool apply(Board *b, Journal *j, ChangeSet *cs, const ReplayEvent *ev) {
+    if (!j) {
+        if (ev->type == REPLAY_REVEAL) board_reveal(b, ev->r, ev->c, NULL);
+        else                           board_toggle_flag(b, ev->r, ev->c, NULL);
+        return true;
+    }
+    changes_clear(cs);
+    switch (ev->type) {
+    case REPLAY_REVEAL: if (board_reveal(b, ev->r, ev->c, cs))      journal_push(j, b, JOURNAL_REVEAL, cs); break;
+    case REPLAY_FLAG:   if (board_toggle_flag(b, ev->r, ev->c, cs)) journal_push(j, b, JOURNAL_FLAG, cs);   break;
+    case REPLAY_UNDO:   return journal_undo(j, b, NULL);
+    case REPLAY_REDO:   return journal_redo(j, b, NULL);
+    }
+    return true;
+}
+
+bool replay_deal(const Replay *rp, Board *b) {
+    if (!board_setup(b, rp->rows, rp->cols, rp->mines)) return false;
+    b->seed = rp->seed;
+    board_place_mines_around(b, rp->deal_r, rp->deal_c);
+    board_compute_neighbors(b);
+    return true;
+}
+
+/* Apply events [from, to) starting at byte offset/time. Started from a
+   keyframe (missed != NULL), the journal begins empty, and an undo or
+   redo that finds nothing in it sets *missed and stops the run
+   (olayları uygula; ana kareden önceye uzanan geri alma *missed'i kurar) */
+static bool run(const Replay *rp, Board *b, size_t from, size_t to, size_t offset, uint64_t t, bool *missed) {
+    ReplayEvent ev;
+    Journal j = {0};
+    ChangeSet cs = {0};
+    bool ok = true;
+    for (size_t i = from; i < to && ok; i++) {
+        if (!(ok = replay_next(rp, &offset, &t, &ev))) break;
+        if (!apply(b, rp->undo ? &j : NULL, &cs, &ev) && missed) { *missed = true; break; }
+    }
+    journal_free(&j);
+    changes_free(&cs);
+    return ok;
+}
+
+/* Lay keyframe k's bitmaps over a freshly dealt b (ana kareyi yükle) */
+static bool load_key(const Replay *rp, Board *b, const ReplayKey *k) {
+    int n = rp->rows * rp->cols, revealed = 0;
+    for (int i = 0; i < n; i++) {
+        uint8_t bit = (uint8_t)(1u << (i & 7)), set = 0;
+        if (k->revealed[i >> 3] & bit) set |= CELL_REVEALED;
+        if (k->flagged[i >> 3] & bit)  set |= CELL_FLAGGED;
+        if (!set) continue;
+        int r = i / rp->cols, c = i % rp->cols;
+        Chunk *ch = board_touch(b, r, c);
+        if (!ch) return false;
+        ch->cell[chunk_index(r, c)] |= set;
+        if (set & CELL_REVEALED) {
+            revealed++;
+            if (ch->cell[chunk_index(r, c)] & CELL_MINE) b->exploded = true;
+        }
+    }
+    b->revealed_count = revealed;
+    return true;
+}
+
+bool replay_seek(const Replay *rp, Board *b, size_t move) {
+    if (move > rp->n_events || !replay_deal(rp, b)) return false;
+    /* Last keyframe at or before the move (hamleden önceki son ana kare) */
+    size_t lo = 0, hi = rp->n_keys;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (rp->keys[mid].event <= move) lo = mid + 1;
+        else                             hi = mid;
+    }
+    /* An undo that reaches past the keyframe sends the seek to the one
+       before it, and past SEEK_TRIES of them to the start
+       (ana kareyi aşan geri alma öncekine, sonra başa döndürür) */
+    for (int tries = 0; lo > 0 && tries < SEEK_TRIES; lo--, tries++) {
+        const ReplayKey *k = &rp->keys[lo - 1];
+        bool missed = false;
+        if (!load_key(rp, b, k) || !run(rp, b, k->event, move, k->offset, k->t_ms, &missed)) return false;
+        if (!missed) return true;
+        if (!replay_deal(rp, b)) return false;
+    }
+    return run(rp, b, 0, move, 0, 0, NULL);
+}
+
+bool replay_verify(const Replay *rp, Board *b) {
+    if (!replay_deal(rp, b) || !run(rp, b, 0, rp->n_events, 0, 0, NULL)) return false;
+    int outcome = b->exploded ? REPLAY_LOST : board_won(b) ? REPLAY_WON : REPLAY_PLAYING;
+    return outcome == rp->outcome && b->revealed_count == rp->revealed;
+}
+
+/* ── File image (Dosya görüntüsü) ────────────────────────────────────── */
+static void put_bitmap(Buf *out, const Board *b, uint8_t flag) {
+    int n = b->rows * b->cols;
+    uint8_t acc = 0;
+    for (int i = 0; i < n; i++) {
+        if (board_cell(b, i / b->cols, i % b->cols) & flag) acc |= (uint8_t)(1u << (i & 7));
+        if ((i & 7) == 7 || i == n - 1) { put_bytes(out, &acc, 1); acc = 0; }
+    }
+}
+
+uint8_t *replay_encode(const Replay *rp, size_t every, size_t *len) {
+    if (rp->oom) return NULL;
+    size_t cells = (size_t)rp->rows * rp->cols;
+    if (!every) every = cells / 8 > 32 ? cells / 8 : 32;   /* bitmaps cost about as much as the events between them (bitmaplar aradaki olaylar kadar) */
+
+    Buf out = {0};
+    uint8_t seed[8];
+    for (int i = 0; i < 8; i++) seed[i] = (uint8_t)(rp->seed >> (8 * i));
+    put_bytes(&out, REPLAY_MAGIC, 4);
+    put_bytes(&out, &(uint8_t){REPLAY_VERSION}, 1);
+    put_varint(&out, (uint64_t)rp->rows);
+    put_varint(&out, (uint64_t)rp->cols);
+    put_varint(&out, (uint64_t)rp->mines);
+    put_varint(&out, (uint64_t)(rp->deal_r + 1));
+    put_varint(&out, (uint64_t)(rp->deal_c + 1));
+    put_bytes(&out, seed, 8);
+    put_varint(&out, rp->n_events);
+    put_varint(&out, rp->ev_len);
+    put_bytes(&out, rp->ev, rp->ev_len);
+
+    /* Keyframes by re-executing the events once, through a journal when
+       the log has undo; no board is dealt when there are none. A due
+       keyframe waits for a click, so no seek from it starts on an undo
+       or redo (ana kareler için bir kez oyna; ana kare bir tıklamayı
+       bekler, atlama geri almayla başlamaz) */
+    size_t n = rp->n_events, n_keys = 0, due = every;
+    if (n <= every) n = 0;
+    Buf keys = {0};
+    Board b = {0};
+    Journal j = {0};
+    ChangeSet cs = {0};
+    bool ok = !n || replay_deal(rp, &b);
+    size_t offset = 0;
+    uint64_t t = 0;
+    ReplayEvent ev;
+    for (size_t i = 0; i < n && ok; i++) {
+        size_t at = offset;
+        uint64_t t_at = t;
+        if (!(ok = replay_next(rp, &offset, &t, &ev))) break;
+        if (i >= due && (ev.type == REPLAY_REVEAL || ev.type == REPLAY_FLAG)) {
+            put_varint(&keys, i);
+            put_varint(&keys, at);
+            put_varint(&keys, t_at);
+            put_bitmap(&keys, &b, CELL_REVEALED);
+            put_bitmap(&keys, &b, CELL_FLAGGED);
+            n_keys++;
+            due = i + every;
+        }
+        apply(&b, rp->undo ? &j : NULL, &cs, &ev);
+    }
+    journal_free(&j);
+    changes_free(&cs);
+    board_free(&b);
+    put_varint(&out, n_keys);
+    put_varint(&out, every);
+    if (keys.len) put_bytes(&out, keys.p, keys.len);
+    free(keys.p);
+    if (!ok || keys.oom) { free(out.p); return NULL; }
+    put_varint(&out, (uint64_t)rp->outcome);
+    put_varint(&out, (uint64_t)rp->revealed);
+    if (out.oom) { free(out.p); return NULL; }
+    *len = out.len;
+    return out.p;
+}
+
+bool replay_decode(Replay *rp, const uint8_t *data, size_t len) {
+    memset(rp, 0, sizeof *rp);
+    if (len < 5 + 8 || memcmp(data, REPLAY_MAGIC, 4) != 0 || data[4] != REPLAY_VERSION) return false;
+    if (!(rp->file = malloc(len))) return false;
+    memcpy(rp->file, data, len);
+    const uint8_t *p = rp->file;
+    size_t pos = 5;
+    uint64_t v[5], n_events, ev_len, n_keys, every, outcome, revealed;
+    for (int i = 0; i < 5; i++)
+        if (!get_varint(p, len, &pos, &v[i])) goto bad;
+    if (v[0] < 1 || v[1] < 1 || v[0] > INT32_MAX || v[1] > INT32_MAX || v[0] * v[1] > INT32_MAX
+        || v[2] > v[0] * v[1] || v[3] > v[0] || v[4] > v[1] || len - pos < 8) goto bad;
+    rp->rows = (int)v[0]; rp->cols = (int)v[1]; rp->mines = (int)v[2];
+    rp->deal_r = (int)v[3] - 1; rp->deal_c = (int)v[4] - 1;
+    for (int i = 0; i < 8; i++) rp->seed |= (uint64_t)p[pos + i] << (8 * i);
+    pos += 8;
+
+    if (!get_varint(p, len, &pos, &n_events) || !get_varint(p, len, &pos, &ev_len) || ev_len > len - pos) goto bad;
+    if (!(rp->ev = malloc(ev_len + 1))) goto bad;
+    memcpy(rp->ev, p + pos, ev_len);
+    rp->ev_len = rp->ev_cap = ev_len;
+    rp->n_events = n_events;
+    pos += ev_len;
+    /* The log must decode, and recording resumes after its last event
+       (kayıt çözülebilmeli; kayıt son olaydan sonra sürer) */
+    size_t off = 0;
+    ReplayEvent ev;
+    for (uint64_t i = 0; i < n_events; i++) {
+        if (!replay_next(rp, &off, &rp->last_ms, &ev)) goto bad;
+        if (ev.type == REPLAY_UNDO || ev.type == REPLAY_REDO) rp->undo = true;
+    }
+
+    size_t map = ((size_t)rp->rows * rp->cols + 7) / 8;
+    if (!get_varint(p, len, &pos, &n_keys) || !get_varint(p, len, &pos, &every) || !every
+        || n_keys > (len - pos) / (2 * map)) goto bad;
+    if (!(rp->keys = malloc((size_t)(n_keys + 1) * sizeof *rp->keys))) goto bad;
+    rp->n_keys = (size_t)n_keys;
+    rp->every  = (size_t)every;
+    for (size_t k = 0; k < rp->n_keys; k++) {
+        uint64_t ev_i, off, t;
+        ReplayKey *key = &rp->keys[k];
+        if (!get_varint(p, len, &pos, &ev_i) || !get_varint(p, len, &pos, &off) || !get_varint(p, len, &pos, &t)
+            || ev_i > n_events || off > ev_len || (k && ev_i <= rp->keys[k - 1].event) || len - pos < 2 * map) goto bad;
+        key->event    = (size_t)ev_i;
+        key->offset   = (size_t)off;
+        key->t_ms     = t;
+        key->revealed = p + pos;
+        key->flagged  = p + pos + map;
+        pos += 2 * map;
+    }
+    if (!get_varint(p, len, &pos, &outcome) || !get_varint(p, len, &pos, &revealed)
+        || outcome > REPLAY_LOST || revealed > v[0] * v[1]) goto bad;
+    rp->outcome  = (int)outcome;
+    rp->revealed = (int)revealed;
+    return true;
+bad:
+    replay_free(rp);
+    return false;
+}
@@ -0,0 +1,124 @@
+/*
+ * replay.h — compact game recordings (sıkıştırılmış oyun kayıtları)
+ *
+ * A game is its deal (size, mines, seed, first-click zone) plus the list
+ * of clicks. Recording a click appends two varints to a byte buffer —
+ * (ms since the previous event << 2 | type) and the cell index — so it
+ * costs no more than a push onto a vector. When the game ends the log is
+ * encoded with keyframes: every `every` events the revealed and flagged
+ * cells are stored as bitmaps, found by re-executing the events once.
+ * Seeking to any move is a binary search over the keyframes and about
+ * `every` events replayed on top. Undo and redo are events too; a log
+ * containing them is replayed through a Journal (journal.h). Keyframes
+ * hold the cells but not the undo history, so one falling due on an undo
+ * or redo waits for the next click, and a seek replays from it with an
+ * empty journal. Only an undo that reaches past the keyframe sends the
+ * seek back to the keyframe before, and past SEEK_TRIES of them to the
+ * first event, at O(n).
+ *
+ * (Bir oyun, dağıtımı ve tıklama listesidir. Tıklama kaydı bir bayt
+ *  tamponuna iki varint ekler. Oyun bitince kayıt ana karelerle kodlanır;
+ *  her hamleye atlama, ana kareler üzerinde ikili arama ve yaklaşık
+ *  `every` olayın yeniden oynanmasıdır. Ana kare geri alma geçmişini
+ *  tutmaz; onu aşan geri alma atlamayı önceki ana kareye, sonra başa
+ *  döndürür.)
+ *
+ * File layout (dosya düzeni), integers as LEB128 varints unless noted:
+ *   "MRPL" u8 version
+ *   rows cols mines deal_r+1 deal_c+1  u64 seed (little-endian)
+ *   n_events  n_bytes  event bytes
+ *   n_keyframes every, then per keyframe: event index, byte offset, time,
+ *     revealed bitmap, flagged bitmap (ceil(rows*cols / 8) bytes each)
+ *   outcome  revealed_count
+ */
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "journal.h"
+
+#define REPLAY_MAGIC   "MRPL"
+#define REPLAY_VERSION 1
+
+enum { REPLAY_REVEAL, REPLAY_FLAG, REPLAY_UNDO, REPLAY_REDO };   /* event types, 2 bits (olay türleri) */
+enum { REPLAY_PLAYING, REPLAY_WON, REPLAY_LOST };          /* outcome (sonuç) */
+
+typedef struct ReplayEvent {
+    int      type, r, c;
+    uint64_t t_ms;            /* since the deal (dağıtımdan beri) */
+} ReplayEvent;
+
+typedef struct ReplayKey {
+    size_t         event;     /* events applied before it (önceki olay sayısı) */
+    size_t         offset;    /* byte offset of the next event (sonraki olayın konumu) */
+    uint64_t       t_ms;
+    const uint8_t *revealed, *flagged;
+} ReplayKey;
+
+typedef struct Replay {
+    int       rows, cols, mines;
+    int       deal_r, deal_c; /* first-click zone, -1 = plain deal (ilk tıklama alanı) */
+    uint64_t  seed;
+    uint8_t  *ev;             /* encoded events (kodlanmış olaylar) */
+    size_t    ev_len, ev_cap, n_events;
+    uint64_t  last_ms;
+    int       outcome, revealed;
+    bool      oom;
+    bool      undo;           /* has undo/redo events (geri alma olayları var) */
+    ReplayKey *keys;          /* filled by replay_decode (çözümlemede dolar) */
+    size_t    n_keys, every;
+    uint8_t  *file;           /* decoded image the keys point into (anahtarların gösterdiği görüntü) */
+} Replay;
+
+/* Start a recording for a board just dealt (r, c = its clear first-click
+   zone, or -1) (yeni dağıtılan tahta için kaydı başlat) */
+void replay_begin(Replay *rp, const Board *b, int deal_r, int deal_c);
+void replay_free(Replay *rp);
+
+/* Copy of the event log alone, without keyframes, for encoding on another
+   thread; false on OOM (yalnızca olay kaydının kopyası) */
+bool replay_copy(Replay *dst, const Replay *src);
+
+/* Append one event; O(1) amortized, never touches the board (olay ekle) */
+void replay_record(Replay *rp, int type, int r, int c, uint64_t t_ms);
+
+/* Note how the game ended (oyunun nasıl bittiğini kaydet) */
+void replay_finish(Replay *rp, const Board *b);
+
+/* After a deferred deal, carry over the flags the player placed before
+   it: each flag still set in journal j is recorded as a flag event at
+   time 0 and journaled again as its own action, in the order first
+   placed, so undo and replay agree. Costs the journal's length, not the
+   board's. On OOM the flags are taken down instead, and false returned
+   (ertelenen dağıtımdan önce dikilen bayrakları kayda ve günlüğe aktar) */
+bool replay_adopt_flags(Replay *rp, Board *b, Journal *j);
+
+/* Serialize with keyframes every `every` events (0 = by board size);
+   returns a malloc'd buffer and its length in *len, NULL on failure
+   (ana karelerle diziye dök) */
+uint8_t *replay_encode(const Replay *rp, size_t every, size_t *len);
+
+/* Parse a file image (copied); false if malformed. Events recorded
+   afterwards are appended to the decoded log (dosya görüntüsünü çözümle) */
+bool replay_decode(Replay *rp, const uint8_t *data, size_t len);
+
+/* Decode event i, walking from byte *offset (olayı çöz) */
+bool replay_next(const Replay *rp, size_t *offset, uint64_t *t_ms, ReplayEvent *ev);
+
+/* Deal the recorded board into b (kaydedilen tahtayı dağıt) */
+bool replay_deal(const Replay *rp, Board *b);
+
+/* Set b to the position after the first `move` events: nearest keyframe
+   by binary search, then the rest replayed; an earlier keyframe or the
+   start if an undo after it reaches past it (hamle sonrasına atla) */
+bool replay_seek(const Replay *rp, Board *b, size_t move);
+
+/* Re-execute every event on b at full speed; true when the result
+   matches the recorded outcome (tüm olayları oyna, sonucu doğrula) */
+bool replay_verify(const Replay *rp, Board *b);
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * rng.h — counter-based pseudo-random numbers (sayaç tabanlı rastgele sayılar)
+ *
+ * Output i of stream `seed` is a pure function mix(seed, i) — the
+ * SplitMix64 finalizer over a Weyl sequence — so a board is fully
+ * determined by its 64-bit seed, any position of a stream can be jumped
+ * to directly, and independent streams (one per thread, one per game)
+ * come from rng_stream() without shared state.
+ *
+ * (i. çıktı saf bir mix(seed, i) işlevidir: tahta 64 bitlik tohumuyla
+ *  tamamen belirlenir, akışın her konumuna doğrudan gidilebilir.)
+ */
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+typedef struct Rng {
+    uint64_t seed;
+    uint64_t ctr;
+} Rng;
+
+static inline uint64_t rng_mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/* Value i of stream seed (seed akışının i. değeri) */
+static inline uint64_t rng_at(uint64_t seed, uint64_t i) {
+    return rng_mix(seed + (i + 1) * 0x9E3779B97F4A7C15ull);
+}
+
+static inline Rng rng_init(uint64_t seed) {
+    Rng g = {seed, 0};
+    return g;
+}
+
+/* Seed of independent sub-stream k, e.g. per worker or per game (alt akış) */
+static inline uint64_t rng_stream(uint64_t seed, uint64_t k) {
+    return rng_mix(seed ^ rng_mix(k + 0xD1B54A32D192ED03ull));
+}
+
+static inline uint64_t rng_next(Rng *g) {
+    return rng_at(g->seed, g->ctr++);
+}
+
+/* Uniform in [0, n) without modulo bias — Lemire's multiply-and-reject
+   (modülo yanlılığı olmadan [0, n) aralığında) */
+static inline uint64_t rng_below(Rng *g, uint64_t n) {
+    unsigned __int128 m = (unsigned __int128)rng_next(g) * n;
+    uint64_t lo = (uint64_t)m;
+    if (lo < n) {
+        uint64_t t = (0 - n) % n;
+        while (lo < t) {
+            m  = (unsigned __int128)rng_next(g) * n;
+            lo = (uint64_t)m;
+        }
+    }
+    return (uint64_t)(m >> 64);
+}
+
+#endif
@@ -0,0 +1,291 @@
+#include "sim.h"
+#include "grade.h"
+#include "prob.h"
+#include "solver.h"
+#include "thread.h"
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_WORKERS 64
+#define BATCH       16        /* games taken from the own slice at a time (tek seferde alınan oyun) */
+#define PICK_SALT   0x5EED5EED5EED5EEDull   /* keeps strategy draws apart from the deal (dağıtımdan ayrı akış) */
+
+/* ── Strategies (Stratejiler) ────────────────────────────────────────── */
+/* k-th closed cell in row-major order (satır sırasıyla k. kapalı hücre) */
+static void nth_closed(const Board *b, uint64_t k, int *r, int *c) {
+    for (int i = 0; i < b->rows; i++)
+        for (int j = 0; j < b->cols; j++)
+            if (!board_revealed(b, i, j) && k-- == 0) { *r = i; *c = j; return; }
+}
+
+static bool random_pick(void *state, const Board *b, Rng *g, int *r, int *c) {
+    (void)state;
+    uint64_t closed = (uint64_t)b->rows * b->cols - (uint64_t)b->revealed_count;
+    if (!closed) return false;
+    nth_closed(b, rng_below(g, closed), r, c);
+    return true;
+}
+
+const SimStrategy sim_random = {"random", NULL, NULL, NULL, random_pick};
+
+/*
+ * The deducing strategies open every cell one deduction proved safe before
+ * looking again, so the solver runs once per stuck position rather than
+ * once per click.
+ * (Çıkarımla oynayan stratejiler, yeniden bakmadan önce kanıtlanan tüm
+ *  güvenli hücreleri açar.)
+ */
+typedef struct {
+    Solver     solver;
+    ProbEngine prob;
+    double    *p;
+    int       *safe;          /* proven safe, not yet opened (kanıtlı, açılmamış) */
+    int        n_safe, cap;
+} Player;
+
+static void *player_start(void) {
+    Player *pl = calloc(1, sizeof *pl);
+    if (pl) pl->prob.threads = 1;    /* games already run on every core (oyunlar zaten paralel) */
+    return pl;
+}
+
+static void player_stop(void *state) {
+    Player *pl = state;
+    if (!pl) return;
+    solver_free(&pl->solver);
+    prob_free(&pl->prob);
+    free(pl->p);
+    free(pl->safe);
+    free(pl);
+}
+
+static void player_new_game(void *state) {
+    ((Player *)state)->n_safe = 0;
+}
+
+/* Next queued safe cell that is still closed (sıradaki kapalı güvenli hücre) */
+static bool pop_safe(Player *pl, const Board *b, int *r, int *c) {
+    while (pl->n_safe) {
+        int i = pl->safe[--pl->n_safe];
+        *r = i / b->cols; *c = i % b->cols;
+        if (!board_revealed(b, *r, *c)) return true;
+    }
+    return false;
+}
+
+/* Queue every cell the last solver_deduce proved safe; false on OOM */
+static bool queue_safe(Player *pl, const Board *b) {
+    int n = b->rows * b->cols;
+    if (pl->cap < n) {
+        int *s = realloc(pl->safe, (size_t)n * sizeof *s);
+        if (!s) return false;
+        pl->safe = s;
+        pl->cap  = n;
+    }
+    for (int i = n - 1; i >= 0; i--)
+        if (solver_state(&pl->solver, i / b->cols, i % b->cols) == SOLVER_SAFE) pl->safe[pl->n_safe++] = i;
+    return true;
+}
+
+static bool solver_pick(void *state, const Board *b, Rng *g, int *r, int *c) {
+    Player *pl = state;
+    if (pop_safe(pl, b, r, c)) return true;
+    if (solver_deduce(&pl->solver, b, false) < 0 || !queue_safe(pl, b)) return false;
+    if (pop_safe(pl, b, r, c)) return true;
+
+    /* Stuck: guess among the undecided cells (takıldı: belirsizlerden tahmin) */
+    uint64_t open = 0;
+    for (int i = 0; i < b->rows; i++)
+        for (int j = 0; j < b->cols; j++) open += solver_state(&pl->solver, i, j) == SOLVER_CLOSED;
+    if (!open) return random_pick(NULL, b, g, r, c);
+    uint64_t k = rng_below(g, open);
+    for (int i = 0; i < b->rows; i++)
+        for (int j = 0; j < b->cols; j++)
+            if (solver_state(&pl->solver, i, j) == SOLVER_CLOSED && k-- == 0) { *r = i; *c = j; return true; }
+    return false;
+}
+
+const SimStrategy sim_solver = {"solver", player_start, player_stop, player_new_game, solver_pick};
+
+static bool prob_pick(void *state, const Board *b, Rng *g, int *r, int *c) {
+    Player *pl = state;
+    if (pop_safe(pl, b, r, c)) return true;
+    if (solver_deduce(&pl->solver, b, false) < 0 || !queue_safe(pl, b)) return false;
+    if (pop_safe(pl, b, r, c)) return true;
+
+    /* Stuck: open the least likely mine, ties broken at random
+       (takıldı: en düşük olasılıklı hücre, eşitlikte rastgele) */
+    size_t n = (size_t)b->rows * b->cols;
+    if (!pl->p && !(pl->p = malloc(n * sizeof *pl->p))) return false;
+    if (!prob_compute(&pl->prob, b, false, pl->p, NULL)) return random_pick(NULL, b, g, r, c);
+    double best = 2;
+    uint64_t ties = 0;
+    for (size_t i = 0; i < n; i++) {
+        int ir = (int)(i / b->cols), ic = (int)(i % b->cols);
+        if (board_revealed(b, ir, ic)) continue;
+        if (pl->p[i] < best - 1e-12) { best = pl->p[i]; ties = 0; }
+        if (pl->p[i] <= best + 1e-12 && rng_below(g, ++ties) == 0) { *r = ir; *c = ic; }
+    }
+    return best <= 1;
+}
+
+const SimStrategy sim_prob = {"prob", player_start, player_stop, player_new_game, prob_pick};
+
+const SimStrategy *sim_strategy(const char *name) {
+    static const SimStrategy *const all[] = {&sim_random, &sim_solver, &sim_prob};
+    for (size_t i = 0; i < sizeof all / sizeof *all; i++)
+        if (strcmp(all[i]->name, name) == 0) return all[i];
+    return NULL;
+}
+
+/* ── Work-stealing pool (İş çalan havuz) ─────────────────────────────── */
+/*
+ * A worker's slice [lo, hi) of game numbers is one atomic word, lo in the
+ * high half. The owner advances lo and a thief lowers hi, both by CAS on
+ * the same word, so neither can take a game the other already has.
+ * (Dilim tek bir atomik sözcüktür; sahibi lo'yu, hırsız hi'yi CAS ile
+ *  oynatır, ikisi aynı oyunu alamaz.)
+ */
+typedef struct {
+    alignas(64) atomic_uint_fast64_t slice;
+} Slice;
+
+static inline uint64_t pack(uint64_t lo, uint64_t hi) { return lo << 32 | hi; }
+
+static bool take_own(Slice *s, uint64_t *lo, uint64_t *hi) {
+    uint_fast64_t v = atomic_load(&s->slice);
+    for (;;) {
+        uint64_t a = v >> 32, z = v & 0xFFFFFFFFu;
+        if (a >= z) return false;
+        uint64_t n = z - a < BATCH ? z - a : BATCH;
+        if (atomic_compare_exchange_weak(&s->slice, &v, pack(a + n, z))) { *lo = a; *hi = a + n; return true; }
+    }
+}
+
+static bool steal(Slice *victim, Slice *own) {
+    uint_fast64_t v = atomic_load(&victim->slice);
+    for (;;) {
+        uint64_t a = v >> 32, z = v & 0xFFFFFFFFu;
+        if (a >= z) return false;
+        uint64_t half = (z - a + 1) / 2;
+        if (atomic_compare_exchange_weak(&victim->slice, &v, pack(a, z - half))) {
+            atomic_store(&own->slice, pack(z - half, z));
+            return true;
+        }
+    }
+}
+
+typedef struct Sim Sim;
+
+typedef struct {
+    Slice     slice;
+    Sim      *sim;
+    int       id;
+    SimResult res;
+    bool      oom;
+} Worker;
+
+struct Sim {
+    const SimConfig   *cfg;
+    const SimStrategy *st;
+    Worker            *w;
+    int                n;
+};
+
+/* Deal game k and play it to the end (k. oyunu dağıt ve sonuna dek oyna) */
+static void play(Worker *w, Board *b, void *state, Grader *gr, uint64_t k) {
+    const SimConfig   *cfg = w->sim->cfg;
+    const SimStrategy *st  = w->sim->st;
+    b->seed = rng_stream(cfg->seed, k);
+    board_place_mines(b);
+    board_compute_neighbors(b);
+    Grade grade;
+    if (grade_board(gr, b, 0, &grade)) w->res.sum_3bv += grade.value[GRADE_3BV];
+    else w->oom = true;
+
+    Rng g = rng_init(rng_stream(cfg->seed ^ PICK_SALT, k));
+    if (st->new_game) st->new_game(state);
+    /* A strategy that keeps clicking opened cells resigns (boşa tıklayan bırakır) */
+    int budget = b->rows * b->cols, r, c;
+    while (!b->exploded && !board_won(b) && budget-- > 0 && st->pick(state, b, &g, &r, &c)) {
+        board_reveal(b, r, c, NULL);
+        w->res.clicks++;
+    }
+    w->res.games++;
+    w->res.wins += board_won(b);
+}
+
+static THREAD_RET worker(void *arg) {
+    Worker *w = arg;
+    Sim    *s = w->sim;
+    const SimConfig *cfg = s->cfg;
+    Board    b = {0};
+    void    *state = s->st->start ? s->st->start() : NULL;
+    Grader   gr = {0};
+    if ((s->st->start && !state) || !board_setup(&b, cfg->rows, cfg->cols, cfg->mines)) {
+        w->oom = true;
+    } else {
+        for (;;) {
+            uint64_t lo, hi;
+            if (!take_own(&w->slice, &lo, &hi)) {
+                /* Steal from the others, nearest first (önce en yakından çal) */
+                bool got = false;
+                for (int i = 1; i < s->n && !got; i++) got = steal(&s->w[(w->id + i) % s->n].slice, &w->slice);
+                if (!got) break;
+                continue;
+            }
+            for (uint64_t k = lo; k < hi; k++) {
+                board_setup(&b, cfg->rows, cfg->cols, cfg->mines);
+                play(w, &b, state, &gr, k);
+            }
+        }
+    }
+    if (s->st->stop) s->st->stop(state);
+    grade_free(&gr);
+    board_free(&b);
+    return 0;
+}
+
+bool sim_run(const SimConfig *cfg, const SimStrategy *st, SimResult *out) {
+    memset(out, 0, sizeof *out);
+    if (!st || !st->pick || cfg->rows <= 0 || cfg->cols <= 0 || cfg->mines < 0
+        || (int64_t)cfg->mines > (int64_t)cfg->rows * cfg->cols || cfg->games > 0xFFFFFFFFu)
+        return false;
+    int threads = cfg->threads > 0 ? cfg->threads : thread_cpu_count();
+    if (threads > MAX_WORKERS) threads = MAX_WORKERS;
+    if ((uint64_t)threads > cfg->games) threads = cfg->games ? (int)cfg->games : 1;
+
+    Worker *w = aligned_alloc(alignof(Worker), (size_t)threads * sizeof *w);
+    if (!w) return false;
+    memset(w, 0, (size_t)threads * sizeof *w);
+    Sim s = {cfg, st, w, threads};
+    for (int i = 0; i < threads; i++) {
+        w[i].sim = &s;
+        w[i].id  = i;
+        atomic_init(&w[i].slice.slice, pack(cfg->games * i / threads, cfg->games * (i + 1) / threads));
+    }
+
+    /* The calling thread is worker 0 (çağıran iş parçacığı 0. işçidir) */
+    Thread t[MAX_WORKERS];
+    int started = 0;
+    while (started < threads - 1 && thread_start(&t[started], worker, &w[started + 1])) started++;
+    /* Slices of workers that failed to start are stolen by the rest
+       (başlamayan işçilerin dilimleri çalınır) */
+    worker(&w[0]);
+    for (int i = 0; i < started; i++) thread_join(t[i]);
+
+    bool ok = true;
+    for (int i = 0; i < threads; i++) {
+        out->games   += w[i].res.games;
+        out->wins    += w[i].res.wins;
+        out->sum_3bv += w[i].res.sum_3bv;
+        out->clicks  += w[i].res.clicks;
+        ok = ok && !w[i].oom;
+    }
+    out->threads = started + 1;
+    free(w);
+    return ok && out->games == cfg->games;
+}
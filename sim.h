@@ -0,0 +1,67 @@
+/*
+ * sim.h — headless Monte Carlo game simulator (başsız Monte Carlo benzetici)
+ *
+ * Plays many complete games with the same core the GUI uses — seeded
+ * placement, neighbor counts, board_reveal — and a pluggable strategy
+ * that picks every click. Game k is dealt from rng_stream(seed, k) and
+ * its strategy draws from its own stream, so a run's results depend only
+ * on the seed, never on how games were spread across threads.
+ *
+ * Games are handed out by a work-stealing pool: each worker starts with
+ * an equal slice of the game numbers and takes small batches from its
+ * front; an idle worker steals the back half of another worker's slice.
+ *
+ * (GUI ile aynı çekirdekle ve takılabilir bir stratejiyle çok sayıda tam
+ *  oyun oynar. k. oyun rng_stream(seed, k) ile dağıtılır; sonuçlar iş
+ *  parçacıklarına dağılımdan bağımsızdır. Boşta kalan işçi başka bir
+ *  işçinin diliminin arka yarısını çalar.)
+ */
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "rng.h"
+
+/*
+ * A strategy keeps per-worker state made by `start` (may be NULL) and is
+ * asked for one cell at a time; it sees only what a player would — use
+ * board_revealed / board_flagged / board_neigh on revealed cells. Returning
+ * false resigns the game.
+ * (Strateji yalnızca oyuncunun gördüğünü görür; false oyunu bırakır.)
+ */
+typedef struct SimStrategy {
+    const char *name;
+    void *(*start)(void);
+    void  (*stop)(void *state);
+    void  (*new_game)(void *state);                 /* optional (isteğe bağlı) */
+    bool  (*pick)(void *state, const Board *b, Rng *g, int *r, int *c);
+} SimStrategy;
+
+extern const SimStrategy sim_random;   /* uniform over closed cells (kapalı hücrelerden rastgele) */
+extern const SimStrategy sim_solver;   /* deduction, random guess when stuck (çıkarım, takılınca rastgele) */
+extern const SimStrategy sim_prob;     /* deduction, safest cell when stuck (çıkarım, takılınca en güvenli) */
+
+/* Look up a built-in strategy by name; NULL if unknown (adıyla strateji) */
+const SimStrategy *sim_strategy(const char *name);
+
+typedef struct SimConfig {
+    int      rows, cols, mines;
+    uint64_t games;
+    uint64_t seed;
+    int      threads;         /* 0 = one per CPU (0 = işlemci başına bir) */
+} SimConfig;
+
+typedef struct SimResult {
+    uint64_t games, wins;
+    uint64_t sum_3bv;         /* over all games, won or lost (tüm oyunlar) */
+    uint64_t clicks;          /* left clicks made (yapılan sol tıklama) */
+    int      threads;
+} SimResult;
+
+/* Play cfg->games games; false on OOM or bad arguments (oyunları oyna) */
+bool sim_run(const SimConfig *cfg, const SimStrategy *st, SimResult *out);
+
+#endif
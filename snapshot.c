@@ -0,0 +1,91 @@
+#include "snapshot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static void wr32(uint8_t *p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static void wr64(uint8_t *p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t rd64(const uint8_t *p) {
+    return (uint64_t)rd32(p) | (uint64_t)rd32(p + 4) << 32;
+}
+
+/* ── Writing (Yazma) ─────────────────────────────────────────────────── */
+uint8_t *snapshot_encode(const Board *b, const SnapInfo *info, size_t *len) {
+    size_t total = (size_t)b->chunk_rows * b->chunk_cols, stored = 0;
+    for (size_t i = 0; i < total; i++) stored += b->chunks[i] != NULL;
+    size_t table = SNAP_HEADER + 4 * total;
+    size_t off   = (table + info->extra_len + SNAP_ALIGN - 1) / SNAP_ALIGN * SNAP_ALIGN;
+    if (off > UINT32_MAX || info->extra_len > UINT32_MAX) return NULL;
+    size_t size  = off + stored * CHUNK_CELLS;
+    uint8_t *p = calloc(1, size);
+    if (!p) return NULL;
+
+    memcpy(p, SNAP_MAGIC, 4);
+    wr32(p + 4,  SNAP_VERSION);
+    wr32(p + 8,  (uint32_t)b->rows);
+    wr32(p + 12, (uint32_t)b->cols);
+    wr32(p + 16, (uint32_t)b->mines);
+    wr32(p + 20, (uint32_t)b->revealed_count);
+    wr64(p + 24, b->seed);
+    wr64(p + 32, info->elapsed_ms);
+    wr32(p + 40, b->exploded ? SNAP_EXPLODED : 0);
+    wr32(p + 44, info->bv);
+    wr32(p + 48, (uint32_t)stored);
+    wr32(p + 52, (uint32_t)info->extra_len);
+    wr32(p + 56, (uint32_t)off);
+    if (info->extra_len) memcpy(p + table, info->extra, info->extra_len);
+
+    uint8_t *chunk = p + off;
+    for (size_t i = 0, k = 0; i < total; i++) {
+        if (!b->chunks[i]) continue;
+        wr32(p + SNAP_HEADER + 4 * i, (uint32_t)++k);
+        memcpy(chunk, b->chunks[i]->cell, CHUNK_CELLS);
+        chunk += CHUNK_CELLS;
+    }
+    *len = size;
+    return p;
+}
+
+/* ── Reading (Okuma) ─────────────────────────────────────────────────── */
+bool snapshot_restore(Board *b, const void *data, size_t size, SnapInfo *info) {
+    const uint8_t *p = data;
+    if (size < SNAP_HEADER || memcmp(p, SNAP_MAGIC, 4) != 0 || rd32(p + 4) != SNAP_VERSION) return false;
+    uint32_t rows = rd32(p + 8), cols = rd32(p + 12), mines = rd32(p + 16), revealed = rd32(p + 20);
+    uint32_t stored = rd32(p + 48), extra = rd32(p + 52), off = rd32(p + 56);
+    if (rows < 1 || cols < 1 || rows > INT32_MAX || cols > INT32_MAX || (uint64_t)rows * cols > INT32_MAX
+        || mines > rows * cols || revealed > rows * cols) return false;
+
+    size_t total = (size_t)((rows + CHUNK_DIM - 1) >> CHUNK_BITS) * ((cols + CHUNK_DIM - 1) >> CHUNK_BITS);
+    size_t table = SNAP_HEADER + 4 * total;
+    if (stored > total || off % SNAP_ALIGN || off < table + extra || off > size
+        || stored > (size - off) / CHUNK_CELLS) return false;
+    if (!board_setup(b, (int)rows, (int)cols, (int)mines)) return false;
+
+    for (size_t i = 0; i < total; i++) {
+        uint32_t k = rd32(p + SNAP_HEADER + 4 * i);
+        if (!k) continue;
+        if (k > stored) { board_setup(b, (int)rows, (int)cols, (int)mines); return false; }
+        int r = (int)(i / (size_t)b->chunk_cols) << CHUNK_BITS, c = (int)(i % (size_t)b->chunk_cols) << CHUNK_BITS;
+        Chunk *ch = board_touch(b, r, c);
+        if (!ch) { board_setup(b, (int)rows, (int)cols, (int)mines); return false; }
+        memcpy(ch->cell, p + off + (size_t)(k - 1) * CHUNK_CELLS, CHUNK_CELLS);
+    }
+    b->seed           = rd64(p + 24);
+    b->revealed_count = (int)revealed;
+    b->exploded       = rd32(p + 40) & SNAP_EXPLODED;
+    info->elapsed_ms  = rd64(p + 32);
+    info->bv          = rd32(p + 44);
+    info->extra       = extra ? p + table : NULL;
+    info->extra_len   = extra;
+    return true;
+}
@@ -0,0 +1,70 @@
+/*
+ * snapshot.h — save and resume a game in progress (oyun anlık görüntüsü)
+ *
+ * A snapshot is the board's own storage written out as it is: every
+ * allocated chunk's packed cell bytes (mine, revealed, flagged bits and
+ * the neighbor count in one byte each), page-aligned so the file can be
+ * memory-mapped, behind a fixed header with the counters, seed and
+ * elapsed time. Restoring copies the chunks back, so nothing — neighbor
+ * counts included — is recomputed, and its cost does not depend on how
+ * far the game had got.
+ *
+ * The packing is the board's own: three state bits and the 4-bit count
+ * share a byte, 7 of its 8 bits used. Separate bit-planes would save at
+ * most the eighth bit unless the counts were dropped, and rebuilding
+ * them costs several times the restore (bench snapshot: 526 ms against
+ * 67 ms at 10^8 cells), so a cell is stored as its byte and untouched
+ * chunks are not stored at all.
+ *
+ * (Anlık görüntü, tahtanın kendi depolamasıdır: ayrılmış her parçanın
+ *  paketli hücre baytları, dosya belleğe eşlenebilsin diye sayfa hizalı.
+ *  Geri yükleme parçaları kopyalar; komşu sayıları yeniden hesaplanmaz.
+ *  Ayrı bit düzlemleri en çok sekizinci biti kazandırır; sayıları yeniden
+ *  hesaplamak geri yüklemeden kat kat pahalıdır.)
+ *
+ * File layout (dosya düzeni), integers little-endian:
+ *    0  "MSNP"
+ *    4  u32 version (SNAP_VERSION)
+ *    8  u32 rows, cols, mines, revealed_count
+ *   24  u64 seed
+ *   32  u64 elapsed_ms
+ *   40  u32 flags (SNAP_EXPLODED), u32 3BV of the deal (0 = unknown)
+ *   48  u32 n_chunks, u32 extra_len, u32 chunk_off, u32 0
+ *   64  chunk_rows × chunk_cols × u32: 0 = untouched, k = stored chunk k-1
+ *       then extra_len bytes of caller data (e.g. the replay log)
+ *  chunk_off (a multiple of SNAP_ALIGN): n_chunks × CHUNK_CELLS bytes,
+ *       each chunk in the Z-order of board.h
+ */
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+
+#define SNAP_MAGIC   "MSNP"
+#define SNAP_VERSION 1
+#define SNAP_HEADER  64
+#define SNAP_ALIGN   4096
+
+enum { SNAP_EXPLODED = 1 };
+
+typedef struct SnapInfo {
+    uint64_t       elapsed_ms;
+    const uint8_t *extra;         /* after restore: points into the image (görüntünün içini gösterir) */
+    size_t         extra_len;
+    uint32_t       bv;            /* the deal's 3BV, 0 = unknown (dağıtımın 3BV'si) */
+} SnapInfo;
+
+/* Serialize b with info; a malloc'd image and its length in *len, NULL on
+   OOM (tahtayı diziye dök) */
+uint8_t *snapshot_encode(const Board *b, const SnapInfo *info, size_t *len);
+
+/* Rebuild b from an image (e.g. a mapped file); false if it is malformed
+   or memory runs out. info->extra stays valid as long as the image does.
+   (Görüntüden tahtayı kur; bozuksa false.) */
+bool snapshot_restore(Board *b, const void *data, size_t size, SnapInfo *info);
+
+#endif
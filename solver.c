@@ -0,0 +1,256 @@
+#include "solver.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* ── Allocation (Bellek ayırma) ──────────────────────────────────────── */
+void solver_free(Solver *s) {
+    free(s->state);
+    free(s->num);
+    free(s->work);
+    free(s->open);
+    free(s->mask);
+    free(s->rem);
+    bool single = s->single_only;
+    memset(s, 0, sizeof *s);
+    s->single_only = single;
+}
+
+/*
+ * Cells are stored with a one-cell border, so index (r+1)*stride + c+1
+ * and every neighbor is a fixed offset away. Border cells read as opened
+ * zeros: never closed, never a mine, never examined.
+ * (Hücreler bir hücrelik kenarlıkla saklanır; komşular sabit uzaklıktadır.
+ *  Kenarlık açık sıfır gibi okunur.)
+ */
+bool solver_setup(Solver *s, int rows, int cols) {
+    if (s->state && s->rows == rows && s->cols == cols) return true;
+    solver_free(s);
+    size_t n = (size_t)(rows + 2) * (cols + 2);
+    s->state = malloc(n * sizeof *s->state);
+    s->num   = calloc(n, sizeof *s->num);
+    s->work  = malloc(n * sizeof *s->work);
+    s->open  = malloc(n * sizeof *s->open);
+    s->mask  = calloc(n, sizeof *s->mask);
+    s->rem   = calloc(n, sizeof *s->rem);
+    if (!s->state || !s->num || !s->work || !s->open || !s->mask || !s->rem) { solver_free(s); return false; }
+    s->rows   = rows;
+    s->cols   = cols;
+    s->stride = cols + 2;
+    memset(s->state, SOLVER_OPEN, n);
+    return true;
+}
+
+/* ── Constraint sets (Kısıt kümeleri) ────────────────────────────────── */
+/*
+ * The closed cells around an opened number form one constraint: "exactly
+ * rem of these are mines". Each number keeps its set as an 8-bit mask
+ * (bit d = neighbor in direction d) and its remaining count, both updated
+ * when a neighbor is decided. Two constraints can only share cells when
+ * their centers are at most two apart, so both fit in the 7×7 window
+ * around the first one; spread into that window as 49-bit masks, set
+ * algebra between neighbors is plain AND/ANDN plus a popcount.
+ *
+ * (Açık bir sayının çevresindeki kapalı hücreler bir kısıttır. Her sayı
+ *  kümesini 8 bitlik maske ve kalan sayı olarak tutar; komşu karar
+ *  verildikçe güncellenir. Merkezleri en çok iki uzak kısıtlar 7×7
+ *  pencereye sığar; küme işlemleri AND/ANDN ve popcount olur.)
+ */
+#define WIN        7
+#define WIN_CENTER (3 * WIN + 3)
+
+#define STATE(s, i) ((s)->state[i] & 3)
+
+/* Direction d and 7 - d are opposite (d ile 7 - d zıt yönlerdir) */
+static const int dir_r[8] = {-1, -1, -1,  0, 0,  1, 1, 1};
+static const int dir_c[8] = {-1,  0,  1, -1, 1, -1, 0, 1};
+
+/* Visit the eight neighbors of cell i as index j; d is the direction
+   (i'nin sekiz komşusunu gez) */
+#define FOR_NEIGHBORS(s, i, j)                                                   \
+    for (int d = 0, j; d < 8 && ((j = (i) + dir_r[d] * (s)->stride + dir_c[d]), 1); d++)
+
+typedef struct {
+    Solver      *s;
+    const Board *b;            /* NULL: deduce only, never open (yalnızca çıkarım) */
+    int          work_top, open_top;
+    bool         failed;       /* opened a mine — inconsistent input (mayın açıldı) */
+} Play;
+
+/* Number i's set as a window mask with its center on bit `center`
+   (i'nin kümesi, merkezi `center` bitinde olan pencere maskesi) */
+static inline uint64_t window_mask(const Solver *s, int i, int center) {
+    uint64_t m = s->mask[i];
+    uint64_t w = (m & 7) | (m >> 3 & 1) << WIN | (m >> 4 & 1) << (WIN + 2) | (m >> 5 & 7) << (2 * WIN);
+    return w << (center - WIN - 1);
+}
+
+/* Build number i's set from its neighbors' states (kümeyi komşulardan kur) */
+static void load_constraint(Solver *s, int i) {
+    unsigned m = 0;
+    int left = s->num[i];
+    FOR_NEIGHBORS(s, i, j) {
+        int st = STATE(s, j);
+        if (st == SOLVER_CLOSED) m |= 1u << d;
+        else if (st == SOLVER_MINE) left--;
+    }
+    s->mask[i] = (uint8_t)m;
+    s->rem[i]  = (int8_t)left;
+}
+
+static void enqueue(Play *p, int i) {
+    Solver *s = p->s;
+    if (STATE(s, i) != SOLVER_OPEN || s->num[i] == 0 || (s->state[i] & SOLVER_QUEUED)) return;
+    s->state[i] |= SOLVER_QUEUED;
+    s->work[p->work_top++] = i;
+}
+
+/* A cell proven safe: open it when playing, else just record it
+   (güvenli hücre: oynarken aç, değilse işaretle) */
+static void prove_safe(Play *p, int i) {
+    Solver *s = p->s;
+    if (STATE(s, i) != SOLVER_CLOSED) return;
+    if (p->b) {
+        int n = board_neigh(p->b, i / s->stride - 1, i % s->stride - 1);
+        if (n < 0) { p->failed = true; return; }
+        s->state[i] = SOLVER_OPEN;
+        s->num[i]   = (int8_t)n;
+        s->opened++;
+        load_constraint(s, i);
+        s->open[p->open_top++] = i;
+    } else {
+        s->state[i] = SOLVER_SAFE;
+        s->decided++;
+    }
+    FOR_NEIGHBORS(s, i, j) {
+        s->mask[j] &= (uint8_t)~(1u << (7 - d));
+        enqueue(p, j);
+    }
+}
+
+static void prove_mine(Play *p, int i) {
+    Solver *s = p->s;
+    if (STATE(s, i) != SOLVER_CLOSED) return;
+    s->state[i] = SOLVER_MINE;
+    s->mines_found++;
+    s->decided++;
+    FOR_NEIGHBORS(s, i, j) {
+        s->mask[j] &= (uint8_t)~(1u << (7 - d));
+        s->rem[j]--;
+        enqueue(p, j);
+    }
+}
+
+/* Apply a window mask back to cells around center i (maskeyi hücrelere uygula) */
+static void apply(Play *p, int i, uint64_t safe, uint64_t mine) {
+    Solver *s = p->s;
+    for (uint64_t m = safe | mine; m; m &= m - 1) {
+        int bit = __builtin_ctzll(m);
+        int j = i + (bit / WIN - 3) * s->stride + (bit % WIN - 3);
+        if ((safe >> bit) & 1) prove_safe(p, j);
+        else                   prove_mine(p, j);
+    }
+}
+
+/*
+ * Rules for the constraint A of number i, in order:
+ *   single cell — rem(A) == 0: all safe; rem(A) == |A|: all mines;
+ *   pairs — for each number j within two cells with set B:
+ *     rem(B) - rem(A) == |B \ A|  ⇒  B \ A all mines, A \ B all safe
+ *   (with A ⊆ B this is the classic subset rule; with A ⊇ B and equal
+ *   counts it clears B's extra cells). Both orders are tried.
+ * Returns true when it decided something.
+ * (Önce tek hücre kuralları, sonra iki hücre yakındaki her sayıyla
+ *  alt/üst küme kuralı.)
+ */
+static bool examine(Play *p, int i) {
+    Solver *s = p->s;
+    int ra = s->rem[i];
+    uint64_t a = window_mask(s, i, WIN_CENTER);
+    if (!a) return false;
+    int na = __builtin_popcountll(a);
+    if (ra == 0)  { apply(p, i, a, 0); return true; }
+    if (ra == na) { apply(p, i, 0, a); return true; }
+    if (s->single_only) return false;
+
+    int r = i / s->stride - 1, c = i % s->stride - 1;
+    for (int dr = -2; dr <= 2; dr++) {
+        if (r + dr < 0 || r + dr >= s->rows) continue;
+        for (int dc = -2; dc <= 2; dc++) {
+            if ((!dr && !dc) || c + dc < 0 || c + dc >= s->cols) continue;
+            int j = i + dr * s->stride + dc;
+            if (STATE(s, j) != SOLVER_OPEN || s->num[j] == 0) continue;
+            int rb = s->rem[j];
+            uint64_t bm = window_mask(s, j, WIN_CENTER + dr * WIN + dc);
+            if (!(bm & a)) continue;            /* disjoint sets say nothing (ayrık kümeler) */
+            uint64_t only_a = a & ~bm, only_b = bm & ~a;
+            if (!(only_a | only_b)) continue;
+            if (rb - ra == __builtin_popcountll(only_b)) { apply(p, i, only_a, only_b); return true; }
+            if (ra - rb == __builtin_popcountll(only_a)) { apply(p, i, only_b, only_a); return true; }
+        }
+    }
+    return false;
+}
+
+/* Drain both lists until no rule fires anywhere (hiçbir kural işlemeyene dek) */
+static void run(Play *p) {
+    Solver *s = p->s;
+    while (!p->failed) {
+        if (p->open_top) {
+            int i = s->open[--p->open_top];
+            if (s->num[i] == 0) FOR_NEIGHBORS(s, i, j) prove_safe(p, j);
+            enqueue(p, i);
+            continue;
+        }
+        if (!p->work_top) break;
+        int i = s->work[--p->work_top];
+        s->state[i] &= (uint8_t)~SOLVER_QUEUED;
+        if (examine(p, i)) enqueue(p, i);       /* may have more to give (yine bakılır) */
+    }
+}
+
+/* ── Entry points (Giriş noktaları) ──────────────────────────────────── */
+static void reset(Solver *s) {
+    for (int r = 0; r < s->rows; r++)
+        memset(s->state + (size_t)(r + 1) * s->stride + 1, SOLVER_CLOSED, (size_t)s->cols);
+    s->opened = s->mines_found = s->decided = 0;
+}
+
+bool solver_solve_from(Solver *s, const Board *b, int r, int c) {
+    if (!solver_setup(s, b->rows, b->cols)) return false;
+    reset(s);
+
+    Play p = {s, b, 0, 0, false};
+    prove_safe(&p, (r + 1) * s->stride + c + 1);
+    run(&p);
+    return !p.failed && (size_t)s->opened == (size_t)b->rows * b->cols - (size_t)b->mines;
+}
+
+int solver_deduce(Solver *s, const Board *b, bool trust_flags) {
+    if (!solver_setup(s, b->rows, b->cols)) return -1;
+    reset(s);
+
+    Play p = {s, NULL, 0, 0, false};
+    for (int r = 0; r < b->rows; r++)
+        for (int c = 0; c < b->cols; c++) {
+            int i = (r + 1) * s->stride + c + 1;
+            uint8_t v = board_cell(b, r, c);
+            if ((v & (CELL_REVEALED | CELL_MINE)) == (CELL_REVEALED | CELL_MINE)) {
+                s->state[i] = SOLVER_MINE;              /* the one that exploded (patlayan mayın) */
+            } else if (v & CELL_REVEALED) {
+                s->state[i] = SOLVER_OPEN;
+                s->num[i]   = (int8_t)(v & CELL_COUNT);
+                s->opened++;
+            } else if (trust_flags && (v & CELL_FLAGGED)) {
+                s->state[i] = SOLVER_MINE;
+            }
+        }
+    for (int r = 0; r < b->rows; r++)
+        for (int c = 0; c < b->cols; c++) {
+            int i = (r + 1) * s->stride + c + 1;
+            if (STATE(s, i) == SOLVER_OPEN) load_constraint(s, i);
+            enqueue(&p, i);
+        }
+    run(&p);
+    return s->decided;
+}
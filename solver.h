@@ -0,0 +1,69 @@
+/*
+ * solver.h — deduction-only Minesweeper solver (yalnızca çıkarımla çözücü)
+ *
+ * Finds what the visible state proves, the way a careful player would:
+ * single-cell rules on each opened number, then subset/superset rules
+ * between numbers whose closed neighborhoods overlap. Constraint sets are
+ * small bit masks, so every rule is a few AND/ANDN/popcount operations.
+ * It never looks at hidden mines — except to read the number under a cell
+ * it has already proven safe, when playing a board from a first click.
+ *
+ * (Görünen durumun kanıtladığını bulur: her açık sayı için tek hücre
+ *  kuralları, sonra çakışan sayılar arasında alt/üst küme kuralları.
+ *  Kısıt kümeleri küçük bit maskeleridir.)
+ */
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "board.h"
+
+/* Scratch state, reused across boards of the same size (aynı boyutta yeniden kullanılır) */
+typedef struct Solver {
+    int      rows, cols, stride;
+    bool     single_only;     /* skip the subset/superset rules (alt küme kurallarını atla) */
+    uint8_t *state;           /* SOLVER_* per cell, row-major with a border (kenarlıklı hücre durumu) */
+    int8_t  *num;             /* neighbor count once opened (açılınca komşu sayısı) */
+    uint8_t *mask;            /* closed neighbors of a number, bit d = direction d (kapalı komşular) */
+    int8_t  *rem;             /* mines still unaccounted for among them (kalan mayın) */
+    int     *work;            /* opened numbers to re-examine (yeniden bakılacak sayılar) */
+    int     *open;            /* cells just opened, neighbors pending (yeni açılanlar) */
+    int      opened, mines_found, decided;
+} Solver;
+
+enum {
+    SOLVER_CLOSED,
+    SOLVER_OPEN,
+    SOLVER_MINE,              /* proven mine (kanıtlanmış mayın) */
+    SOLVER_SAFE,              /* proven safe, still closed (kanıtlanmış güvenli, kapalı) */
+    SOLVER_QUEUED = 0x80,     /* on the work-list (iş listesinde) */
+};
+
+bool solver_setup(Solver *s, int rows, int cols);   /* false on OOM */
+void solver_free(Solver *s);
+
+/*
+ * Play b from a first click on (r, c) with deduction only, opening every
+ * cell proven safe. The board is read, never modified. Returns true when
+ * every safe cell was opened.
+ * (b'yi (r, c)'den yalnızca çıkarımla oynar; tüm güvenli hücreler açılırsa true.)
+ */
+bool solver_solve_from(Solver *s, const Board *b, int r, int c);
+
+/*
+ * Everything the visible state of b proves without opening anything:
+ * afterwards each closed cell of s->state is SOLVER_SAFE, SOLVER_MINE or
+ * still SOLVER_CLOSED (undecided). Flags count as mines only when
+ * trust_flags is set. Returns the number of cells decided, -1 on OOM.
+ * (Hiçbir şey açmadan görünen durumun kanıtladıkları; bayraklar yalnızca
+ *  trust_flags ile mayın sayılır.)
+ */
+int  solver_deduce(Solver *s, const Board *b, bool trust_flags);
+
+static inline int solver_state(const Solver *s, int r, int c) {
+    return s->state[(size_t)(r + 1) * s->stride + c + 1] & 3;
+}
+
+#endif
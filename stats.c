@@ -0,0 +1,82 @@
+#include "stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static uint64_t max_u64(uint64_t a, uint64_t b) { return a > b ? a : b; }
+
+static void add(StatBlock *to, const StatBlock *g) {
+    to->actions        += g->actions;
+    to->cells_revealed += g->cells_revealed;
+    to->max_flood       = max_u64(to->max_flood, g->max_flood);
+    to->cells_painted  += g->cells_painted;
+    to->paint_peak      = max_u64(to->paint_peak, g->paint_peak);
+    to->invalidations  += g->invalidations;
+    to->paints         += g->paints;
+    to->relayouts      += g->relayouts;
+    to->relayout_us    += g->relayout_us;
+    to->deals          += g->deals;
+    to->deal_us        += g->deal_us;
+    to->pooled         += g->pooled;
+    to->candidates     += g->candidates;
+    to->wall_ms        += g->wall_ms;
+}
+
+void stats_new_game(Stats *s, uint64_t now_ms) {
+    if (s->games) {
+        s->game.wall_ms = now_ms - s->game_t0;
+        add(&s->done, &s->game);
+    }
+    memset(&s->game, 0, sizeof s->game);
+    s->games++;
+    s->game_t0 = now_ms;
+}
+
+static double per(uint64_t a, uint64_t b) { return b ? (double)a / (double)b : 0.0; }
+
+size_t stats_format(const Stats *s, uint64_t now_ms, char *buf, size_t size) {
+    StatBlock g = s->game, t = s->done;
+    g.wall_ms = now_ms - s->game_t0;
+    add(&t, &g);
+
+    /* Stable English keys: the text is also the dump format
+       (sabit İngilizce anahtarlar: metin aynı zamanda döküm biçimidir) */
+    int n = snprintf(buf, size,
+        "%-22s %12s %12s\r\n"
+        "%-22s %12s %12llu\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12.1f %12.1f\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12.0f %12.0f\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12.3f %12.3f\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12.3f %12.3f\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12llu %12llu\r\n"
+        "%-22s %12.1f %12.1f\r\n",
+        "", "game", "session",
+        "games", "", (unsigned long long)s->games,
+        "actions", (unsigned long long)g.actions, (unsigned long long)t.actions,
+        "cells_revealed", (unsigned long long)g.cells_revealed, (unsigned long long)t.cells_revealed,
+        "cells_per_action", per(g.cells_revealed, g.actions), per(t.cells_revealed, t.actions),
+        "max_flood", (unsigned long long)g.max_flood, (unsigned long long)t.max_flood,
+        "cells_painted", (unsigned long long)g.cells_painted, (unsigned long long)t.cells_painted,
+        "cells_painted_per_s", per(g.cells_painted * 1000, g.wall_ms), per(t.cells_painted * 1000, t.wall_ms),
+        "cells_painted_peak_s", (unsigned long long)g.paint_peak, (unsigned long long)t.paint_peak,
+        "invalidations", (unsigned long long)g.invalidations, (unsigned long long)t.invalidations,
+        "paints", (unsigned long long)g.paints, (unsigned long long)t.paints,
+        "relayouts", (unsigned long long)g.relayouts, (unsigned long long)t.relayouts,
+        "relayout_ms", g.relayout_us / 1e3, t.relayout_us / 1e3,
+        "deals", (unsigned long long)g.deals, (unsigned long long)t.deals,
+        "deal_ms", g.deal_us / 1e3, t.deal_us / 1e3,
+        "deals_pooled", (unsigned long long)g.pooled, (unsigned long long)t.pooled,
+        "noguess_candidates", (unsigned long long)g.candidates, (unsigned long long)t.candidates,
+        "wall_s", g.wall_ms / 1e3, t.wall_ms / 1e3);
+    return n < 0 ? 0 : (size_t)n;
+}
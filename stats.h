@@ -0,0 +1,66 @@
+/*
+ * stats.h — always-on performance counters (her zaman açık sayaçlar)
+ *
+ * Plain integer counters the UI bumps as it works: reveals and their
+ * sizes, cells painted and the busiest second of painting, invalidated
+ * rectangles, layout and deal times. Bumping one is an add on a struct
+ * field, so they stay in release builds. The current game's counters are
+ * kept apart from the session's earlier games and folded in when a new
+ * game starts; stats_format prints both as text.
+ *
+ * (Arayüzün çalışırken artırdığı düz tamsayı sayaçlar; artırmak bir
+ *  toplamadır, bu yüzden sürüm derlemesinde de kalırlar. Geçerli oyunun
+ *  sayaçları önceki oyunlardan ayrı tutulur ve yeni oyunda onlara eklenir.)
+ */
+#ifndef STATS_H
+#define STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct StatBlock {
+    uint64_t actions;         /* reveals that opened something (bir şey açan tıklamalar) */
+    uint64_t cells_revealed;
+    uint64_t max_flood;       /* largest single opening (en büyük tek açılış) */
+    uint64_t cells_painted;   /* cells drawn into the back buffer (arka tampona çizilen hücreler) */
+    uint64_t paint_peak;      /* most cells painted within one second (bir saniyedeki en çok çizim) */
+    uint64_t invalidations;   /* rectangles invalidated on the grid (geçersiz kılınan dikdörtgenler) */
+    uint64_t paints;          /* WM_PAINT messages handled (işlenen WM_PAINT) */
+    uint64_t relayouts, relayout_us;
+    uint64_t deals, deal_us;
+    uint64_t pooled;          /* deals served ready from the pool (havuzdan hazır gelen dağıtımlar) */
+    uint64_t candidates;      /* no-guess boards tried (denenen tahminsiz tahtalar) */
+    uint64_t wall_ms;         /* time covered (kapsanan süre) */
+} StatBlock;
+
+typedef struct Stats {
+    StatBlock game;           /* the game in progress (süren oyun) */
+    StatBlock done;           /* earlier games of this session (oturumun önceki oyunları) */
+    uint64_t  games;          /* games started (başlayan oyunlar) */
+    uint64_t  game_t0;        /* ms at the game's start (oyunun başladığı an) */
+    uint64_t  sec, sec_cells; /* current one-second paint bucket (geçerli bir saniyelik dilim) */
+} Stats;
+
+static inline void stats_reveal(Stats *s, uint64_t cells) {
+    s->game.actions++;
+    s->game.cells_revealed += cells;
+    if (cells > s->game.max_flood) s->game.max_flood = cells;
+}
+
+static inline void stats_painted(Stats *s, uint64_t cells, uint64_t now_ms) {
+    s->game.cells_painted += cells;
+    if (now_ms / 1000 != s->sec) { s->sec = now_ms / 1000; s->sec_cells = 0; }
+    s->sec_cells += cells;
+    if (s->sec_cells > s->game.paint_peak) s->game.paint_peak = s->sec_cells;
+}
+
+/* Fold the finished game into the session and start a new one at now_ms
+   (biten oyunu oturuma ekle, yenisini başlat) */
+void stats_new_game(Stats *s, uint64_t now_ms);
+
+/* Write the counters as text, one per line with a column for this game
+   and one for the whole session; returns the length, like snprintf
+   (sayaçları metin olarak yaz) */
+size_t stats_format(const Stats *s, uint64_t now_ms, char *buf, size_t size);
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * thread.h — minimal portable threads (taşınabilir iş parçacıkları)
+ *
+ * Win32 threads in the GUI build, pthreads on Linux for the headless
+ * tools. A thread function is declared as
+ *     static THREAD_RET worker(void *arg) { …; return 0; }
+ * A ThreadEvent is an auto-reset wake-up flag: event_set leaves it set
+ * until one event_wait consumes it, so a wake-up is never lost.
+ * (GUI derlemesinde Win32, Linux araçlarında pthreads. ThreadEvent kendini
+ *  sıfırlayan bir uyandırma bayrağıdır; uyandırma kaybolmaz.)
+ */
+#ifndef THREAD_H
+#define THREAD_H
+
+#include <stdbool.h>
+
+#ifdef _WIN32
+#include <windows.h>
+
+typedef HANDLE Thread;
+#define THREAD_RET DWORD WINAPI
+
+static inline bool thread_start(Thread *t, DWORD (WINAPI *fn)(void *), void *arg) {
+    *t = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)fn, arg, 0, NULL);
+    return *t != NULL;
+}
+
+static inline void thread_join(Thread t) {
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+}
+
+static inline int thread_cpu_count(void) {
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return si.dwNumberOfProcessors > 0 ? (int)si.dwNumberOfProcessors : 1;
+}
+
+static inline void thread_yield(void) {
+    SwitchToThread();
+}
+
+typedef HANDLE ThreadEvent;
+
+static inline bool event_init(ThreadEvent *e) {
+    *e = CreateEventW(NULL, FALSE, FALSE, NULL);
+    return *e != NULL;
+}
+
+static inline void event_set(ThreadEvent *e)  { SetEvent(*e); }
+static inline void event_wait(ThreadEvent *e) { WaitForSingleObject(*e, INFINITE); }
+static inline void event_free(ThreadEvent *e) { CloseHandle(*e); }
+
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+typedef pthread_t Thread;
+#define THREAD_RET void *
+
+static inline bool thread_start(Thread *t, void *(*fn)(void *), void *arg) {
+    return pthread_create(t, NULL, fn, arg) == 0;
+}
+
+static inline void thread_join(Thread t) {
+    pthread_join(t, NULL);
+}
+
+static inline int thread_cpu_count(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+static inline void thread_yield(void) {
+    sched_yield();
+}
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    bool            set;
+} ThreadEvent;
+
+static inline bool event_init(ThreadEvent *e) {
+    e->set = false;
+    if (pthread_mutex_init(&e->lock, NULL) != 0) return false;
+    if (pthread_cond_init(&e->cond, NULL) != 0) { pthread_mutex_destroy(&e->lock); return false; }
+    return true;
+}
+
+static inline void event_set(ThreadEvent *e) {
+    pthread_mutex_lock(&e->lock);
+    e->set = true;
+    pthread_cond_signal(&e->cond);
+    pthread_mutex_unlock(&e->lock);
+}
+
+static inline void event_wait(ThreadEvent *e) {
+    pthread_mutex_lock(&e->lock);
+    while (!e->set) pthread_cond_wait(&e->cond, &e->lock);
+    e->set = false;
+    pthread_mutex_unlock(&e->lock);
+}
+
+static inline void event_free(ThreadEvent *e) {
+    pthread_cond_destroy(&e->cond);
+    pthread_mutex_destroy(&e->lock);
+}
+#endif
+
+#endif
@@ -0,0 +1,130 @@
+#include "trace.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define RING_SIZE (1u << TRACE_RING_BITS)
+
+typedef struct TraceEvent {
+    const char *name;
+    uint64_t    ticks;
+    uint32_t    tid, arg;
+    char        ph;
+} TraceEvent;
+
+typedef struct TraceRing {
+    struct TraceRing *next;
+    atomic_bool       idle;           /* no thread owns it (sahipsiz) */
+    atomic_uint_fast64_t head;        /* events ever written, owner only (yazılan olay sayısı) */
+    TraceEvent        ev[RING_SIZE];
+} TraceRing;
+
+static _Atomic(TraceRing *) g_rings;  /* every ring ever made, never unlinked (tüm halkalar) */
+static _Thread_local TraceRing *t_ring;
+static _Thread_local uint32_t   t_tid;
+
+#ifdef _WIN32
+static uint64_t ticks(void) {
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return (uint64_t)t.QuadPart;
+}
+
+static double ticks_per_us(void) {
+    LARGE_INTEGER f;
+    QueryPerformanceFrequency(&f);
+    return (double)f.QuadPart / 1e6;
+}
+
+static uint32_t thread_id(void) { return (uint32_t)GetCurrentThreadId(); }
+#else
+static uint64_t ticks(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static double ticks_per_us(void) { return 1e3; }
+
+static uint32_t thread_id(void) {
+    static atomic_uint next = 1;
+    return atomic_fetch_add(&next, 1);
+}
+#endif
+
+/* A thread's first event takes an idle ring or links a new one in front
+   (ilk olayda boşta bir halka alınır ya da yenisi eklenir) */
+static TraceRing *claim(void) {
+    for (TraceRing *r = atomic_load(&g_rings); r; r = r->next) {
+        bool idle = true;
+        if (atomic_load_explicit(&r->idle, memory_order_relaxed)
+            && atomic_compare_exchange_strong(&r->idle, &idle, false))
+            return r;
+    }
+    TraceRing *r = calloc(1, sizeof *r);
+    if (!r) return NULL;
+    atomic_init(&r->idle, false);
+    atomic_init(&r->head, 0);
+    r->next = atomic_load(&g_rings);
+    while (!atomic_compare_exchange_weak(&g_rings, &r->next, r)) {}
+    return r;
+}
+
+void trace_event(const char *name, char ph, uint32_t arg) {
+    TraceRing *r = t_ring;
+    if (!r) {
+        if (!(r = t_ring = claim())) return;
+        t_tid = thread_id();
+    }
+    uint64_t h = atomic_load_explicit(&r->head, memory_order_relaxed);
+    TraceEvent *e = &r->ev[h & (RING_SIZE - 1)];
+    e->name  = name;
+    e->ticks = ticks();
+    e->tid   = t_tid;
+    e->arg   = arg;
+    e->ph    = ph;
+    atomic_store_explicit(&r->head, h + 1, memory_order_release);
+}
+
+void trace_thread_exit(void) {
+    if (!t_ring) return;
+    atomic_store(&t_ring->idle, true);
+    t_ring = NULL;
+}
+
+bool trace_dump(FILE *f) {
+    double per_us = ticks_per_us();
+    uint64_t t0 = UINT64_MAX;
+    for (TraceRing *r = atomic_load(&g_rings); r; r = r->next) {
+        uint64_t h = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (h) {
+            uint64_t first = h > RING_SIZE ? h - RING_SIZE : 0;
+            uint64_t t = r->ev[first & (RING_SIZE - 1)].ticks;
+            if (t < t0) t0 = t;
+        }
+    }
+
+    /* Times are relative to the oldest event kept (zaman en eski olaydan) */
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", f);
+    const char *sep = "\n";
+    for (TraceRing *r = atomic_load(&g_rings); r; r = r->next) {
+        uint64_t h = atomic_load_explicit(&r->head, memory_order_acquire);
+        for (uint64_t i = h > RING_SIZE ? h - RING_SIZE : 0; i < h; i++) {
+            const TraceEvent *e = &r->ev[i & (RING_SIZE - 1)];
+            fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u",
+                    sep, e->name, e->ph, (double)(e->ticks - t0) / per_us, e->tid);
+            if (e->ph == 'i') fputs(",\"s\":\"t\"", f);
+            if (e->arg) fprintf(f, ",\"args\":{\"n\":%u}", e->arg);
+            fputc('}', f);
+            sep = ",\n";
+        }
+    }
+    fputs("\n]}\n", f);
+    return !ferror(f);
+}
@@ -0,0 +1,57 @@
+/*
+ * trace.h — event tracing for Chrome's trace viewer (olay izleme)
+ *
+ * TRACE_BEGIN / TRACE_END bracket a span of work, TRACE_MARK records an
+ * instant. Built with -DMINES_TRACE they append one event to the calling
+ * thread's ring buffer; without it they expand to nothing, so probes can
+ * stay in the hot paths. Each thread owns its ring outright — the only
+ * shared step is linking a new ring into the list, one compare-and-swap —
+ * so recording takes no lock: a timestamp read and a 32-byte store.
+ * A full ring overwrites its oldest events.
+ *
+ * trace_dump writes every ring as Chrome trace_event JSON; open it in
+ * chrome://tracing or ui.perfetto.dev. Dump while the traced threads are
+ * idle (for the game: at exit), since a ring is not copied atomically.
+ *
+ * (-DMINES_TRACE ile her sonda çağıran iş parçacığının halka tamponuna
+ *  bir olay ekler; onsuz hiçbir kod üretmez. Kilit yoktur: yalnızca yeni
+ *  halkanın listeye eklenmesi tek bir CAS'tır. trace_dump tüm halkaları
+ *  Chrome trace_event JSON olarak yazar.)
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRACE_RING_BITS 14                        /* 16384 events per thread (iş parçacığı başına olay) */
+
+/* Record one event: ph is 'B' (begin), 'E' (end) or 'i' (instant); name
+   must be a string literal or otherwise outlive the dump
+   (bir olay kaydet; ad dökümden uzun yaşamalı) */
+void trace_event(const char *name, char ph, uint32_t arg);
+
+/* Hand the calling thread's ring back for reuse by a later thread; call
+   before a short-lived thread returns (halkayı yeniden kullanıma bırak) */
+void trace_thread_exit(void);
+
+/* Write all rings as {"traceEvents": [...]}; false on a write error
+   (tüm halkaları JSON olarak yaz) */
+bool trace_dump(FILE *f);
+
+#ifdef MINES_TRACE
+#define TRACE_BEGIN(name)          trace_event(name, 'B', 0)
+#define TRACE_BEGIN_ARG(name, arg) trace_event(name, 'B', (uint32_t)(arg))
+#define TRACE_END(name)            trace_event(name, 'E', 0)
+#define TRACE_MARK(name, arg)      trace_event(name, 'i', (uint32_t)(arg))
+#define TRACE_THREAD_EXIT()        trace_thread_exit()
+#else
+#define TRACE_BEGIN(name)          ((void)0)
+#define TRACE_BEGIN_ARG(name, arg) ((void)0)
+#define TRACE_END(name)            ((void)0)
+#define TRACE_MARK(name, arg)      ((void)0)
+#define TRACE_THREAD_EXIT()        ((void)0)
+#endif
+
+#endif